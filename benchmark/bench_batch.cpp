@@ -0,0 +1,141 @@
+// Throughput of BatchLinearConstrainSystem compared with solving the same problems one by one
+// through LinearConstrainSystem::optimize
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/BatchLinearConstrainSystem.hpp"
+#include "../include/LinearConstrainSystem.hpp"
+
+
+typedef LinearConstrainSystem<double> System;
+
+const size_t ROWS = 8;          //!< number of constrains of every problem
+const size_t COLUMNS = 6;       //!< number of decisional variables of every problem
+const size_t PROBLEMS = 4096;   //!< number of problems solved, a multiple of every batch size
+
+
+/**
+ * @brief struct representing the coefficients of a problem, whose shape is shared by all of them
+ */
+struct Problem {
+    std::vector<std::vector<double>> a;     //!< constrain coefficients
+    std::vector<double> b;                  //!< constant terms
+    std::vector<double> c;                  //!< objective function coefficients
+};
+
+
+/**
+ * @brief method to solve all the problems K at a time with BatchLinearConstrainSystem
+ * @return 'double' sum of the optimal values, to compare with the sequential solve
+ */
+template<size_t K>
+double solve_batched(const std::vector<Problem>& problems, const std::vector<System::ConstrainType>& types) {
+
+    BatchLinearConstrainSystem<double, K> batch(COLUMNS);
+    std::array<std::vector<double>, K> a;
+    std::array<double, K> b;
+    std::array<std::vector<double>, K> c;
+    std::array<std::vector<double>, K> solutions;
+    double total = 0;
+    for (size_t first = 0; first < problems.size(); first += K) {
+        for (size_t i = 0; i < ROWS; ++i) {
+            for (size_t lane = 0; lane < K; ++lane) {
+                a[lane] = problems[first + lane].a[i];
+                b[lane] = problems[first + lane].b[i];
+            }
+            if (first == 0) {
+                batch.add_constrain(a, b, types[i]);
+            } else {
+                batch.set_constrain(i, a, b);
+            }
+        }
+        for (size_t lane = 0; lane < K; ++lane) {
+            c[lane] = problems[first + lane].c;
+        }
+        auto sol_types = batch.optimize(solutions, c, System::OptimizationType::MAX);
+        for (size_t lane = 0; lane < K; ++lane) {
+            total += (sol_types[lane] == System::SolutionType::BOUNDED) ? solutions[lane].back() : 0;
+        }
+    }
+    return total;
+}
+
+
+/**
+ * @brief method to time a solve, returning the elapsed seconds
+ */
+template<typename Solve>
+double time_solve(Solve solve, double& total) {
+    auto start = std::chrono::steady_clock::now();
+    total = solve();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+int main() {
+
+    // feasible bounded problems: LE rows with positive coefficients and a GE row every four
+    std::minstd_rand engine(1);
+    std::uniform_real_distribution<double> value(1, 10);
+    std::vector<System::ConstrainType> types(ROWS);
+    for (size_t i = 0; i < ROWS; ++i) {
+        types[i] = (i % 4 == 3) ? System::ConstrainType::GE : System::ConstrainType::LE;
+    }
+    std::vector<Problem> problems(PROBLEMS);
+    for (auto& problem : problems) {
+        problem.a.assign(ROWS, std::vector<double>(COLUMNS));
+        problem.b.resize(ROWS);
+        problem.c.resize(COLUMNS);
+        for (size_t i = 0; i < ROWS; ++i) {
+            for (auto& coefficient : problem.a[i]) {
+                coefficient = value(engine);
+            }
+            problem.b[i] = (types[i] == System::ConstrainType::GE) ? value(engine) : 100 + 10 * value(engine);
+        }
+        for (auto& coefficient : problem.c) {
+            coefficient = value(engine);
+        }
+    }
+
+    // LinearConstrainSystem::optimize prints every problem: output is discarded while timing
+    std::cout.setstate(std::ios::failbit);
+    double sequential_total = 0;
+    double sequential_time = time_solve([&]() {
+        System system;
+        std::vector<double> solution;
+        double total = 0;
+        for (size_t p = 0; p < problems.size(); ++p) {
+            for (size_t i = 0; i < ROWS; ++i) {
+                if (p == 0) {
+                    system.add_constrain(problems[p].a[i], problems[p].b[i], types[i]);
+                } else {
+                    system.set_constrain(i, problems[p].a[i], problems[p].b[i], types[i]);
+                }
+            }
+            if (system.optimize(solution, problems[p].c, System::OptimizationType::MAX) == System::SolutionType::BOUNDED) {
+                total += solution.back();
+            }
+        }
+        return total;
+    }, sequential_total);
+    double totals[3];
+    double times[3];
+    times[0] = time_solve([&]() { return solve_batched<4>(problems, types); }, totals[0]);
+    times[1] = time_solve([&]() { return solve_batched<8>(problems, types); }, totals[1]);
+    times[2] = time_solve([&]() { return solve_batched<16>(problems, types); }, totals[2]);
+    std::cout.clear();
+
+    std::cout << PROBLEMS << " problems with " << ROWS << " constrains and " << COLUMNS << " variables" << std::endl;
+    std::cout << "LinearConstrainSystem::optimize: " << sequential_time << " s" << std::endl;
+    const size_t lanes[3] = {4, 8, 16};
+    for (size_t k = 0; k < 3; ++k) {
+        std::cout << "BatchLinearConstrainSystem<double, " << lanes[k] << ">: " << times[k] << " s, speedup "
+                  << sequential_time / times[k] << (std::fabs(totals[k] - sequential_total) <= 1e-6 * std::fabs(sequential_total) ? "" : ", RESULTS DIFFER")
+                  << std::endl;
+    }
+    return 0;
+}
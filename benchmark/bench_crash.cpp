@@ -0,0 +1,127 @@
+// Pivots of the simplex with and without the crash of the starting base, see LinearConstrainSystem::set_crash
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/LinearConstrainSystem.hpp"
+
+
+typedef LinearConstrainSystem<double> System;
+
+
+/**
+ * @brief struct representing a random problem
+ */
+struct Problem {
+    std::vector<std::vector<double>> a;     //!< constrain coefficients
+    std::vector<double> b;                  //!< constant terms
+    std::vector<System::ConstrainType> types;   //!< constrain types
+    std::vector<double> c;                  //!< objective function coefficients
+};
+
+
+/**
+ * @brief struct collecting the results of solving all the problems with one setting
+ */
+struct Result {
+    size_t iterations{0};       //!< total number of pivots, crash included
+    size_t infeasible{0};       //!< number of infeasible problems
+    double total{0};            //!< sum of the optimal values of bounded problems
+    double seconds{0};          //!< elapsed time
+};
+
+
+/**
+ * @brief method to solve all the problems with the crash enabled or disabled
+ */
+Result solve_all(const std::vector<Problem>& problems, bool crash) {
+
+    Result result;
+    std::vector<double> solution;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& problem : problems) {
+        System system;
+        system.set_crash(crash);
+        for (size_t i = 0; i < problem.a.size(); ++i) {
+            system.add_constrain(problem.a[i], problem.b[i], problem.types[i]);
+        }
+        try {
+            if (system.optimize(solution, problem.c, System::OptimizationType::MIN) == System::SolutionType::BOUNDED) {
+                result.total += solution.back();
+            }
+        } catch (const InfeasibleSystemError&) {
+            result.infeasible++;
+        }
+        result.iterations += system.get_iterations();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+
+int main() {
+
+    // sparse problems with GE and EQ rows, each starting with an artificial variable in base; in the
+    // second family every row also has a column of its own, e.g. a shortage variable, that the crash
+    // can put in base in place of the artificial variable
+    const size_t sizes[3][2] = {{20, 30}, {50, 75}, {100, 150}};
+    const size_t count = 50;
+    std::minstd_rand engine(1);
+    std::uniform_real_distribution<double> value(1, 10);
+    std::uniform_real_distribution<double> uniform(0, 1);
+
+    for (size_t family = 0; family < 2; ++family) {
+    for (const auto& size : sizes) {
+        size_t rows = size[0];
+        size_t columns = size[1] + (family == 1 ? rows : 0);
+        std::vector<Problem> problems(count);
+        for (auto& problem : problems) {
+            problem.a.assign(rows, std::vector<double>(columns, 0));
+            problem.b.resize(rows);
+            problem.types.resize(rows);
+            for (size_t i = 0; i < rows; ++i) {
+                for (size_t j = 0; j < size[1]; ++j) {
+                    if (uniform(engine) < 0.1 || j % rows == i) {
+                        problem.a[i][j] = value(engine);
+                    }
+                }
+                if (family == 1) {
+                    problem.a[i][size[1] + i] = 1;
+                }
+                problem.b[i] = value(engine);
+                problem.types[i] = (i % 5 == 0) ? System::ConstrainType::EQ
+                                 : (i % 5 == 1) ? System::ConstrainType::LE : System::ConstrainType::GE;
+                if (problem.types[i] == System::ConstrainType::LE) {
+                    problem.b[i] *= 10;
+                }
+            }
+            problem.c.resize(columns);
+            for (auto& coefficient : problem.c) {
+                coefficient = value(engine);
+            }
+            // columns of their own row are expensive, as shortages
+            for (size_t j = size[1]; j < columns; ++j) {
+                problem.c[j] *= 100;
+            }
+        }
+
+        // LinearConstrainSystem::optimize prints every problem: output is discarded while solving
+        std::cout.setstate(std::ios::failbit);
+        Result cold = solve_all(problems, false);
+        Result crashed = solve_all(problems, true);
+        std::cout.clear();
+
+        std::cout << count << " problems with " << rows << " constrains and " << columns << " variables"
+                  << (family == 1 ? ", one column of its own per row" : "") << " (" << cold.infeasible << " infeasible)" << std::endl;
+        std::cout << "  without crash: " << cold.iterations << " pivots, " << cold.seconds << " s" << std::endl;
+        std::cout << "  with crash:    " << crashed.iterations << " pivots, " << crashed.seconds << " s, "
+                  << std::showpos << 100.0 * (static_cast<double>(crashed.iterations) / cold.iterations - 1.0) << std::noshowpos << "% pivots"
+                  << (crashed.infeasible == cold.infeasible && std::fabs(crashed.total - cold.total) <= 1e-6 * (1 + std::fabs(cold.total)) ? "" : ", RESULTS DIFFER")
+                  << std::endl;
+    }
+    }
+    return 0;
+}
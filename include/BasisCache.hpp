@@ -0,0 +1,220 @@
+#ifndef __BASISCACHE_HPP__
+#define __BASISCACHE_HPP__
+
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+template<typename T>
+struct LinearConstrainSystem;
+
+
+
+/**
+ * @brief class for a cache of optimal bases, keyed by the structure of the constrain system
+ *
+ * Systems with the same fingerprint (number of variables and constrains, constrain types and
+ * positions of nonzero coefficients) are solved again with slightly different coefficients: the
+ * optimal base of the last one is a good starting base for the next. Bases are stored as variable
+ * indices that do not depend on the layout of the tableau, see LinearConstrainSystem::set_basis_cache.
+ * The most recently used bases are kept, up to capacity. The cache can be shared by systems solved
+ * on different threads.
+ *
+ * @tparam T
+ */
+template<typename T>
+class BasisCache {
+
+    /**
+     * @brief struct representing a cached base
+    */
+    struct Entry {
+        uint64_t fingerprint;           //!< fingerprint of the constrain system
+        std::vector<size_t> base;       //!< variables of the optimal base
+    };
+
+    std::list<Entry> entries;           //!< cached bases, the most recently used first
+    size_t capacity;                    //!< largest number of cached bases
+    size_t found{0};                    //!< number of successful calls of find since the last clear
+    std::mutex mutex;                   //!< mutex protecting entries
+
+  public:
+
+    /**
+     * @brief constructor
+     *
+     * @param capacity largest number of cached bases
+     */
+    BasisCache(size_t capacity = 64) : capacity(capacity) {}
+
+    // method to get the cache shared by the whole process
+    static std::shared_ptr<BasisCache> global();
+    // method to compute the fingerprint of the structure of a constrain system
+    static uint64_t fingerprint(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains);
+    // method to look for the base of a fingerprint
+    bool find(uint64_t fingerprint, std::vector<size_t>& base);
+    // method to store the base of a fingerprint
+    void store(uint64_t fingerprint, const std::vector<size_t>& base);
+    // method to remove every cached base
+    void clear();
+    // method to get the number of cached bases
+    size_t size();
+    // method to get the number of bases found since the last clear
+    size_t hits();
+};
+
+
+/**
+ * @brief method to get the cache shared by the whole process, created at the first call
+ *
+ * @tparam T
+ * @return 'std::shared_ptr<BasisCache<T>>' the process-wide cache
+ */
+template<typename T>
+std::shared_ptr<BasisCache<T>> BasisCache<T>::global() {
+
+    static std::shared_ptr<BasisCache<T>> cache = std::make_shared<BasisCache<T>>();
+    return cache;
+}
+
+
+/**
+ * @brief method to compute the fingerprint of the structure of a constrain system: a 64-bit FNV-1a
+ * hash of its dimensions, constrain types and positions of nonzero coefficients
+ *
+ * Coefficients and constant terms are left out, so systems differing only in their values share
+ * the fingerprint.
+ *
+ * @tparam T
+ * @param constrains vector of Constrain objects to represent system constrains
+ * @return 'uint64_t' fingerprint
+ */
+template<typename T>
+uint64_t BasisCache<T>::fingerprint(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains) {
+
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint64_t value) {
+        for (size_t byte = 0; byte < sizeof(value); ++byte) {
+            hash ^= (value >> (8 * byte)) & 0xff;
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(constrains.size());
+    mix(constrains.empty() ? 0 : constrains[0].a.size());
+    for (const auto& constrain : constrains) {
+        mix(static_cast<uint64_t>(constrain.type));
+        for (size_t j = 0; j < constrain.a.size(); ++j) {
+            if (constrain.a[j] != 0) {
+                mix(j);
+            }
+        }
+        // end of the row, so that nonzeros of consecutive rows can not be shifted between them
+        mix(~0ull);
+    }
+    return hash;
+}
+
+
+/**
+ * @brief method to look for the base of a fingerprint, which becomes the most recently used
+ *
+ * @tparam T
+ * @param fingerprint fingerprint of the constrain system
+ * @param base vector where the variables of the base are written if found
+ * @return true if a base is cached for fingerprint
+ */
+template<typename T>
+bool BasisCache<T>::find(uint64_t fingerprint, std::vector<size_t>& base) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+        if (entry->fingerprint == fingerprint) {
+            entries.splice(entries.begin(), entries, entry);
+            base.assign(entry->base.begin(), entry->base.end());
+            ++found;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief method to store the base of a fingerprint, replacing the previous one; the least recently
+ * used base is dropped when the cache is full
+ *
+ * @tparam T
+ * @param fingerprint fingerprint of the constrain system
+ * @param base variables of the optimal base
+ */
+template<typename T>
+void BasisCache<T>::store(uint64_t fingerprint, const std::vector<size_t>& base) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+        if (entry->fingerprint == fingerprint) {
+            entries.splice(entries.begin(), entries, entry);
+            entry->base.assign(base.begin(), base.end());
+            return;
+        }
+    }
+    if (capacity == 0) {
+        return;
+    }
+    if (entries.size() == capacity) {
+        // the memory of the dropped base is reused
+        entries.splice(entries.begin(), entries, std::prev(entries.end()));
+    } else {
+        entries.emplace_front();
+    }
+    entries.front().fingerprint = fingerprint;
+    entries.front().base.assign(base.begin(), base.end());
+}
+
+
+/**
+ * @brief method to remove every cached base, resetting the count of hits
+ *
+ * @tparam T
+ */
+template<typename T>
+void BasisCache<T>::clear() {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    found = 0;
+}
+
+
+/**
+ * @brief method to get the number of cached bases
+ *
+ * @tparam T
+ * @return 'size_t' number of cached bases
+ */
+template<typename T>
+size_t BasisCache<T>::size() {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+
+/**
+ * @brief method to get the number of bases found since the last clear, i.e. of warm starts attempted
+ *
+ * @tparam T
+ * @return 'size_t' number of successful calls of find
+ */
+template<typename T>
+size_t BasisCache<T>::hits() {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return found;
+}
+
+#endif // __BASISCACHE_HPP__
@@ -0,0 +1,202 @@
+#ifndef __BATCHLINEARCONSTRAINSYSTEM_HPP__
+#define __BATCHLINEARCONSTRAINSYSTEM_HPP__
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include "LinearConstrainSystem.hpp"
+#include "BatchTableau.hpp"
+
+
+/**
+ * @brief Struct to represent K linear constrain systems with the same number of variables and
+ * constrains and the same constrain types, differing only in coefficients
+ *
+ * The K problems are solved together by BatchTableau, one SIMD lane per problem: meant for
+ * thousands of small problems of the same shape, where solving them one by one through
+ * LinearConstrainSystem<T>::optimize leaves the vector units idle. Problems ending early are
+ * masked while the others go on. Infeasible systems are reported through SolutionType::INFEASIBLE
+ * instead of an exception, so that one problem does not stop the batch. Steps are printed only when
+ * PRINT is defined.
+ *
+ * @tparam T is the parametric type
+ * @tparam K number of problems solved together
+ */
+template<typename T, size_t K>
+struct BatchLinearConstrainSystem {
+
+    typedef typename LinearConstrainSystem<T>::SolutionType SolutionType;
+    typedef typename LinearConstrainSystem<T>::ConstrainType ConstrainType;
+    typedef typename LinearConstrainSystem<T>::OptimizationType OptimizationType;
+
+    /**
+     * @brief struct representing a constrain of the K problems
+    */
+    struct Constrain {
+        std::vector<T> a;       //!< constrain coefficients, coefficient j of lane k at j * K + k
+        std::array<T, K> b;     //!< constant term of every lane
+        ConstrainType type;     //!< constrain type, shared by all lanes
+    };
+
+    /**
+     * @brief constructor
+     *
+     * @param num_variables number of decisional variables of every problem
+     */
+    BatchLinearConstrainSystem(size_t num_variables) : num_variables(num_variables) {}
+
+    /**
+     * @brief Add constrain a*x type b to all the problems, with coefficients of every lane
+     *
+     * @param a constrain coefficients of every lane
+     * @param b known term of every lane
+     * @param type constrain type
+     */
+    inline BatchLinearConstrainSystem& add_constrain(const std::array<std::vector<T>, K>& a, const std::array<T, K>& b, const ConstrainType type){
+        constrains.emplace_back();
+        constrains.back().type = type;
+        set_coefficients(constrains.size() - 1, a, b);
+        return *this;
+    }
+
+    /**
+     * @brief Replace coefficients of constrain at position index, keeping its type and reusing its memory,
+     * so that the next batch of problems of the same shape does not allocate
+     *
+     * @param index position of the constrain, in order of insertion
+     * @param a constrain coefficients of every lane
+     * @param b known term of every lane
+     */
+    inline BatchLinearConstrainSystem& set_constrain(size_t index, const std::array<std::vector<T>, K>& a, const std::array<T, K>& b){
+        if (index >= constrains.size()) {
+            throw std::out_of_range("Constrain index out of range");
+        }
+        set_coefficients(index, a, b);
+        return *this;
+    }
+
+    // method to optimize c*x for every problem
+    std::array<SolutionType, K> optimize(std::array<std::vector<T>, K>& solutions, const std::array<std::vector<T>, K>& c, const OptimizationType type);
+
+  private:
+
+    std::vector<Constrain> constrains;  //!< vector containing objects of type Constrain
+    size_t num_variables;               //!< number of decisional variables of every problem
+    BatchTableau<T, K> tab;             //!< object of the struct BatchTableau
+
+    // method to write coefficients of a constrain in lane-interleaved order
+    void set_coefficients(size_t index, const std::array<std::vector<T>, K>& a, const std::array<T, K>& b);
+};
+
+
+/**
+ * @brief method to write coefficients of a constrain in lane-interleaved order
+ *
+ * @tparam T
+ * @tparam K
+ * @param index position of the constrain
+ * @param a constrain coefficients of every lane
+ * @param b known term of every lane
+ */
+template<typename T, size_t K>
+void BatchLinearConstrainSystem<T, K>::set_coefficients(size_t index, const std::array<std::vector<T>, K>& a, const std::array<T, K>& b) {
+
+    for (const auto& lane_a : a) {
+        if (lane_a.size() != num_variables) {
+            throw std::invalid_argument("Wrong number of variables in constrain");
+        }
+    }
+    Constrain& constrain = constrains[index];
+    constrain.a.resize(num_variables * K);
+    for (size_t j = 0; j < num_variables; ++j) {
+        for (size_t lane = 0; lane < K; ++lane) {
+            constrain.a[j * K + lane] = a[lane][j];
+        }
+    }
+    constrain.b = b;
+}
+
+
+/**
+ * @brief method to optimize c*x for every problem, running the simplex on all lanes in lockstep
+ *
+ * Symbolic Big-M pricing considers real costs only once no M part is negative, i.e. once the sum
+ * of artificial variables is minimum: a lane stopped with an artificial variable still positive,
+ * optimal or unbounded, is therefore infeasible.
+ *
+ * @tparam T
+ * @tparam K
+ * @param solutions vector of every lane, containing decisional variables and z, as written by
+ * LinearConstrainSystem<T>::optimize; left unchanged for lanes that are not BOUNDED
+ * @param c objective function coefficients of every lane
+ * @param type optimization type, shared by all lanes
+ * @return std::array<SolutionType, K> solution type of every lane
+ */
+template<typename T, size_t K>
+std::array<typename BatchLinearConstrainSystem<T, K>::SolutionType, K> BatchLinearConstrainSystem<T, K>::optimize(std::array<std::vector<T>, K>& solutions,
+                                                                                                              const std::array<std::vector<T>, K>& c,
+                                                                                                              const OptimizationType type) {
+
+    if (constrains.empty()) {
+        throw std::invalid_argument("The constrain system is empty");
+    }
+    for (const auto& lane_c : c) {
+        if (lane_c.size() != num_variables) {
+            throw std::invalid_argument("Wrong number of variables in objective function");
+        }
+    }
+    tab.create_initial_tableau(constrains, num_variables);
+    tab.add_objFunc_tableau(c, type);
+
+    std::array<SolutionType, K> sol_types;
+    sol_types.fill(SolutionType::BOUNDED);
+    // lanes still running have a pivot column different from -1
+    std::array<int, K> pivot_column;
+    std::array<int, K> pivot_row;
+    pivot_column.fill(0);
+
+    tab.find_pivot_columns(pivot_column);
+    bool running = true;
+    while (running) {
+        tab.find_pivot_rows(pivot_column, pivot_row);
+        running = false;
+        for (size_t lane = 0; lane < K; ++lane) {
+            if (pivot_column[lane] != -1 && pivot_row[lane] == -1) {
+                sol_types[lane] = SolutionType::UNBOUNDED;
+                pivot_column[lane] = -1;
+            }
+            running = running || pivot_column[lane] != -1;
+        }
+        if (running) {
+            tab.pivot(pivot_row, pivot_column);
+            tab.find_pivot_columns(pivot_column);
+        }
+    }
+
+    size_t ObjFunc_row = tab.num_constrains;
+    // the tableau always minimizes: results of a maximization have opposite sign
+    T sign = (type == OptimizationType::MAX) ? -1 : 1;
+    for (size_t lane = 0; lane < K; ++lane) {
+        if (tab.has_positive_artificial(lane)) {
+            sol_types[lane] = SolutionType::INFEASIBLE;
+        }
+        if (sol_types[lane] != SolutionType::BOUNDED) {
+            continue;
+        }
+        // writing decisional variables in base, all the others are 0
+        std::vector<T>& solution = solutions[lane];
+        solution.assign(num_variables, 0);
+        for (size_t row = 0; row < tab.num_constrains; ++row) {
+            size_t column = tab.base[row * K + lane];
+            if (column >= tab.get_decVars_index()) {
+                solution[column - tab.get_decVars_index()] = tab.at(row, tab.columns - 1, lane);
+            }
+        }
+        // the constant term of objective function row is -z of the minimization
+        solution.emplace_back(-sign * tab.at(ObjFunc_row, tab.columns - 1, lane));
+    }
+    return sol_types;
+}
+
+#endif // __BATCHLINEARCONSTRAINSYSTEM_HPP__
@@ -0,0 +1,414 @@
+#ifndef __BATCHTABLEAU_HPP__
+#define __BATCHTABLEAU_HPP__
+
+
+#include <array>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "LinearConstrainSystem.hpp"
+
+
+template<typename T, size_t K>
+struct BatchLinearConstrainSystem;
+
+
+
+/**
+ * @brief class for K tableaus of problems with the same dimensions and constrain types, stored in
+ * structure-of-arrays form
+ *
+ * Element (row, column) of the K tableaus is kept in K consecutive values, one lane per problem,
+ * so every step loops over lanes innermost and the compiler can process all problems with SIMD
+ * instructions. Columns have the fixed layout of FixedTableau: row i owns columns 2i (slack or
+ * artificial variable) and 2i+1 (surplus variable), so the layout does not depend on the signs of
+ * constant terms, which differ among lanes. Pricing, ratio test and pivot run on all lanes in
+ * lockstep: a lane whose pivot column is -1 is masked out of the pivot.
+ *
+ * @tparam T is the parametric type
+ * @tparam K number of problems, i.e. of lanes
+ */
+template<typename T, size_t K>
+class BatchTableau {
+
+    std::vector<T> tableau;             //!< tableau matrices, value (row, column, lane) at (row * columns + column) * K + lane
+    std::vector<size_t> base;           //!< base variable index, value (row, lane) at row * K + lane
+    std::vector<char> artificial;       //!< 1 for columns of artificial variables, value (column, lane) at column * K + lane
+    size_t num_variables{0};            //!< number of decisional variables
+    size_t num_constrains{0};           //!< number of constrains
+    size_t columns{0};                  //!< additional variables, decisional variables and constant term
+    T tolerance = std::numeric_limits<T>::epsilon() * 1024; //!< values whose magnitude is below tolerance are treated as 0
+    std::array<T, K> cost_tolerance;    //!< tolerance of real parts of reduced costs of every lane, scaled by add_objFunc_tableau
+    std::array<T, K> big_M_tolerance;   //!< tolerance of M parts of reduced costs of every lane, scaled by add_objFunc_tableau
+
+    std::vector<T> pivot_row_values;    //!< buffer for the pivot row of every lane divided by its pivot element
+    std::vector<T> pivot_column_values; //!< buffer for the pivot column of every lane, all rows included
+
+    // empty constructor
+    BatchTableau() {}
+
+    /**
+     * @brief method to access element (row, column) of lane
+     */
+    inline T& at(size_t row, size_t column, size_t lane) { return tableau[(row * columns + column) * K + lane]; }
+    /**
+     * @brief method to read element (row, column) of lane
+     */
+    inline const T& at(size_t row, size_t column, size_t lane) const { return tableau[(row * columns + column) * K + lane]; }
+    /**
+     * @brief method to get index of the first decisional variable column
+     */
+    inline size_t get_decVars_index() const { return 2 * num_constrains; }
+
+    // method to add system constrains in tableau
+    void create_initial_tableau(const std::vector<typename BatchLinearConstrainSystem<T, K>::Constrain>& constrains, size_t num_variables);
+    // method to add objective function rows with "Big-M" method
+    void add_objFunc_tableau(const std::array<std::vector<T>, K>& c, const typename LinearConstrainSystem<T>::OptimizationType type);
+    // method to identify base entering variable of every lane
+    void find_pivot_columns(std::array<int, K>& pivot_column) const;
+    // method to identify base exiting variable of every lane
+    void find_pivot_rows(const std::array<int, K>& pivot_column, std::array<int, K>& pivot_row);
+    // method to perform pivot operation on every lane with a pivot
+    void pivot(const std::array<int, K>& pivot_row, const std::array<int, K>& pivot_column);
+    // method to set to 0 the M parts of reduced costs within tolerance
+    void clear_big_M_noise();
+    // method to check whether an artificial variable is left in base with positive value
+    bool has_positive_artificial(size_t lane) const;
+
+    #ifdef PRINT
+    /**
+     * @brief method to print the tableau of every lane
+    */
+    void print_tableau() const;
+    #endif // PRINT
+
+    friend struct BatchLinearConstrainSystem<T, K>;
+};
+
+
+/**
+ * @brief method to add system constrains in tableau; rows with negative constant term are multiplied
+ * by -1 lane by lane, which only changes the values of the columns owned by the row
+ *
+ * @tparam T
+ * @tparam K
+ * @param constrains vector of Constrain objects, coefficients of all lanes included
+ * @param num_variables number of decisional variables
+ */
+template<typename T, size_t K>
+void BatchTableau<T, K>::create_initial_tableau(const std::vector<typename BatchLinearConstrainSystem<T, K>::Constrain>& constrains,
+                                                size_t num_variables) {
+
+    typedef typename LinearConstrainSystem<T>::ConstrainType ConstrainType;
+
+    this->num_variables = num_variables;
+    num_constrains = constrains.size();
+    columns = 2 * num_constrains + num_variables + 1;
+    // buffers are reused when problems of the same size are solved again
+    tableau.assign((num_constrains + 2) * columns * K, 0);
+    base.resize(num_constrains * K);
+    artificial.assign(2 * num_constrains * K, 0);
+    pivot_row_values.resize(columns * K);
+    pivot_column_values.resize((num_constrains + 2) * K);
+
+    for (size_t i = 0; i < num_constrains; ++i) {
+        const auto& constrain = constrains[i];
+        // column of the variable placed in base for this row
+        size_t column = 2 * i;
+        for (size_t lane = 0; lane < K; ++lane) {
+            const T& b = constrain.b[lane];
+            // rows with negative constant term are multiplied by -1, turning LE into GE and vice versa
+            T sign = (b < 0) ? -1 : 1;
+            bool is_LE = constrain.type == ConstrainType::LE ? b >= 0 : constrain.type == ConstrainType::GE && b < 0;
+
+            base[i * K + lane] = column;
+            // slack variable (LE) or artificial variable (GE, EQ)
+            at(i, column, lane) = 1;
+            if (!is_LE) {
+                artificial[column * K + lane] = 1;
+            }
+            // surplus variable (GE)
+            if (!is_LE && constrain.type != ConstrainType::EQ) {
+                at(i, column + 1, lane) = -1;
+            }
+            // inserting coefficients of vector a in correct position
+            for (size_t j = 0; j < num_variables; ++j) {
+                at(i, get_decVars_index() + j, lane) = sign * constrain.a[j * K + lane];
+            }
+            // adding constant term
+            at(i, columns - 1, lane) = sign * b;
+        }
+    }
+}
+
+
+/**
+ * @brief method to add objective function rows with "Big-M" method: as in Tableau<T>, row
+ * num_constrains holds the real costs and row num_constrains + 1 the coefficients of M
+ *
+ * @tparam T
+ * @tparam K
+ * @param c objective function coefficients of every lane
+ * @param type optimization type, shared by all lanes
+ */
+template<typename T, size_t K>
+void BatchTableau<T, K>::add_objFunc_tableau(const std::array<std::vector<T>, K>& c, const typename LinearConstrainSystem<T>::OptimizationType type) {
+
+    size_t ObjFunc_row = num_constrains;
+    size_t BigM_row = num_constrains + 1;
+    // the tableau always minimizes: maximization uses opposite coefficients
+    T sign = (type == LinearConstrainSystem<T>::OptimizationType::MAX) ? -1 : 1;
+    for (size_t j = 0; j < num_variables; ++j) {
+        for (size_t lane = 0; lane < K; ++lane) {
+            at(ObjFunc_row, get_decVars_index() + j, lane) = sign * c[lane][j];
+        }
+    }
+
+    // "Big-M method" phase: M on artificial variables, then removed subtracting their rows
+    for (size_t i = 0; i < num_constrains; ++i) {
+        for (size_t col = 0; col < columns; ++col) {
+            for (size_t lane = 0; lane < K; ++lane) {
+                at(BigM_row, col, lane) -= artificial[2 * i * K + lane] ? at(i, col, lane) : 0;
+            }
+        }
+        for (size_t lane = 0; lane < K; ++lane) {
+            if (artificial[2 * i * K + lane]) {
+                at(BigM_row, 2 * i, lane) = 0;
+            }
+        }
+    }
+    // pricing tolerances are relative to the largest value of each objective function row, as in Tableau<T>
+    cost_tolerance.fill(1);
+    big_M_tolerance.fill(1);
+    for (size_t col = 0; col < columns - 1; ++col) {
+        for (size_t lane = 0; lane < K; ++lane) {
+            T cost = at(ObjFunc_row, col, lane) < 0 ? -at(ObjFunc_row, col, lane) : at(ObjFunc_row, col, lane);
+            T big_M_cost = at(BigM_row, col, lane) < 0 ? -at(BigM_row, col, lane) : at(BigM_row, col, lane);
+            cost_tolerance[lane] = cost > cost_tolerance[lane] ? cost : cost_tolerance[lane];
+            big_M_tolerance[lane] = big_M_cost > big_M_tolerance[lane] ? big_M_cost : big_M_tolerance[lane];
+        }
+    }
+    for (size_t lane = 0; lane < K; ++lane) {
+        cost_tolerance[lane] *= tolerance;
+        big_M_tolerance[lane] *= tolerance;
+    }
+    clear_big_M_noise();
+    #ifdef PRINT
+    print_tableau();
+    #endif // PRINT
+}
+
+
+/**
+ * @brief method to determine the base-entering variable column of every lane, comparing reduced
+ * costs lexicographically on (M part, real part); lanes with pivot_column -1 on input are skipped
+ *
+ * @tparam T
+ * @tparam K
+ * @param pivot_column on input -1 for masked lanes, on output index of base-entering variable column,
+ * -1 if the tableau of the lane is optimal
+ */
+template<typename T, size_t K>
+void BatchTableau<T, K>::find_pivot_columns(std::array<int, K>& pivot_column) const {
+
+    size_t ObjFunc_row = num_constrains;
+    size_t BigM_row = num_constrains + 1;
+    // reduced cost (M part, real part) of pivot column of every lane
+    std::array<T, K> pivot_big_M;
+    std::array<T, K> pivot_value;
+    std::array<int, K> candidate;
+    pivot_big_M.fill(0);
+    pivot_value.fill(0);
+    candidate.fill(-1);
+
+    // the same comparisons of Tableau<T>::find_pivot_column, written as selections over lanes
+    for (size_t col = 0; col < columns - 1; ++col) {
+        const T* big_M = &at(BigM_row, col, 0);
+        const T* value = &at(ObjFunc_row, col, 0);
+        for (size_t lane = 0; lane < K; ++lane) {
+            bool negative_M = big_M[lane] < -big_M_tolerance[lane];
+            bool better_M = negative_M && big_M[lane] < pivot_big_M[lane];
+            bool better_value = !negative_M && big_M[lane] <= big_M_tolerance[lane] && pivot_big_M[lane] == 0 &&
+                                value[lane] < -cost_tolerance[lane] && value[lane] < pivot_value[lane];
+            bool take = better_M || better_value;
+            pivot_big_M[lane] = better_M ? big_M[lane] : pivot_big_M[lane];
+            pivot_value[lane] = take ? value[lane] : pivot_value[lane];
+            candidate[lane] = take ? static_cast<int>(col) : candidate[lane];
+        }
+    }
+    for (size_t lane = 0; lane < K; ++lane) {
+        pivot_column[lane] = pivot_column[lane] == -1 ? -1 : candidate[lane];
+    }
+}
+
+
+/**
+ * @brief method to find the base-exiting variable row of every lane with a pivot column; the pivot
+ * columns are first gathered in a contiguous buffer, which pivot reuses
+ *
+ * @tparam T
+ * @tparam K
+ * @param pivot_column index of base-entering variable column of every lane, -1 for masked lanes
+ * @param pivot_row index of base-exiting variable row, -1 for masked lanes and unbounded problems
+ */
+template<typename T, size_t K>
+void BatchTableau<T, K>::find_pivot_rows(const std::array<int, K>& pivot_column, std::array<int, K>& pivot_row) {
+
+    // pivot column of every lane, 0 for masked lanes
+    for (size_t row = 0; row < num_constrains + 2; ++row) {
+        for (size_t lane = 0; lane < K; ++lane) {
+            pivot_column_values[row * K + lane] = pivot_column[lane] == -1 ? 0 : at(row, pivot_column[lane], lane);
+        }
+    }
+
+    std::array<T, K> min_ratio;
+    min_ratio.fill(std::numeric_limits<T>::max());
+    pivot_row.fill(-1);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        const T* column = &pivot_column_values[row * K];
+        const T* constant = &at(row, columns - 1, 0);
+        for (size_t lane = 0; lane < K; ++lane) {
+            // ratio only for positive coefficients (values within tolerance are rounding noise)
+            bool positive = column[lane] > tolerance;
+            T ratio = positive ? constant[lane] / column[lane] : std::numeric_limits<T>::max();
+            bool take = positive && ratio < min_ratio[lane];
+            min_ratio[lane] = take ? ratio : min_ratio[lane];
+            pivot_row[lane] = take ? static_cast<int>(row) : pivot_row[lane];
+        }
+    }
+}
+
+
+/**
+ * @brief method for pivot operation on every lane with a pivot; it must follow find_pivot_rows,
+ * whose buffer holds the pivot columns
+ *
+ * @tparam T
+ * @tparam K
+ * @param pivot_row index of base exiting variable row of every lane, -1 for masked lanes
+ * @param pivot_column index of base entering variable column of every lane, -1 for masked lanes
+ */
+template<typename T, size_t K>
+void BatchTableau<T, K>::pivot(const std::array<int, K>& pivot_row, const std::array<int, K>& pivot_column) {
+
+    // masked lanes get a null pivot row and null factors, so the update leaves them unchanged
+    std::array<bool, K> active;
+    for (size_t lane = 0; lane < K; ++lane) {
+        active[lane] = pivot_row[lane] != -1 && pivot_column[lane] != -1;
+    }
+    for (size_t lane = 0; lane < K; ++lane) {
+        if (!active[lane]) {
+            for (size_t col = 0; col < columns; ++col) {
+                pivot_row_values[col * K + lane] = 0;
+            }
+            continue;
+        }
+        base[pivot_row[lane] * K + lane] = pivot_column[lane];
+        T pivot_element = at(pivot_row[lane], pivot_column[lane], lane);
+        for (size_t col = 0; col < columns; ++col) {
+            pivot_row_values[col * K + lane] = at(pivot_row[lane], col, lane) / pivot_element;
+        }
+        // the pivot row is written from the buffer below, not updated
+        pivot_column_values[pivot_row[lane] * K + lane] = 0;
+    }
+
+    // updating all the rows of all the lanes at once
+    for (size_t row = 0; row < num_constrains + 2; ++row) {
+        const T* factor = &pivot_column_values[row * K];
+        bool any_factor = false;
+        for (size_t lane = 0; lane < K; ++lane) {
+            any_factor = any_factor || factor[lane] != 0;
+        }
+        if (!any_factor) {
+            continue;
+        }
+        for (size_t col = 0; col < columns; ++col) {
+            T* element = &at(row, col, 0);
+            const T* pivot_value = &pivot_row_values[col * K];
+            for (size_t lane = 0; lane < K; ++lane) {
+                element[lane] -= factor[lane] * pivot_value[lane];
+            }
+        }
+    }
+    for (size_t lane = 0; lane < K; ++lane) {
+        if (active[lane]) {
+            for (size_t col = 0; col < columns; ++col) {
+                at(pivot_row[lane], col, lane) = pivot_row_values[col * K + lane];
+            }
+        }
+    }
+    clear_big_M_noise();
+    #ifdef PRINT
+    print_tableau();
+    #endif // PRINT
+}
+
+
+/**
+ * @brief method to set to 0 the M parts of reduced costs within the tolerance of their lane, which
+ * are rounding noise, so that it does not build up; as in Tableau<T>, it ends every pivot and
+ * add_objFunc_tableau
+ *
+ * @tparam T
+ * @tparam K
+ */
+template<typename T, size_t K>
+void BatchTableau<T, K>::clear_big_M_noise() {
+
+    size_t BigM_row = num_constrains + 1;
+    for (size_t col = 0; col < columns - 1; ++col) {
+        T* big_M = &at(BigM_row, col, 0);
+        for (size_t lane = 0; lane < K; ++lane) {
+            bool null_M = big_M[lane] >= -big_M_tolerance[lane] && big_M[lane] <= big_M_tolerance[lane];
+            big_M[lane] = null_M ? 0 : big_M[lane];
+        }
+    }
+}
+
+
+/**
+ * @brief method to check whether the Big-M method left an artificial variable in base with positive
+ * value in a lane, i.e. whether the constrain system of that lane is infeasible
+ *
+ * @tparam T
+ * @tparam K
+ * @param lane index of the problem
+ */
+template<typename T, size_t K>
+bool BatchTableau<T, K>::has_positive_artificial(size_t lane) const {
+
+    for (size_t row = 0; row < num_constrains; ++row) {
+        size_t column = base[row * K + lane];
+        if (column < get_decVars_index() && artificial[column * K + lane] && at(row, columns - 1, lane) > tolerance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef PRINT
+
+/**
+ * @brief method to print the tableau of every lane
+ *
+ * @tparam T
+ * @tparam K
+ */
+template<typename T, size_t K>
+void BatchTableau<T, K>::print_tableau() const {
+
+    for (size_t lane = 0; lane < K; ++lane) {
+        std::cout << std::endl << "Lane " << lane << std::endl;
+        for (size_t row = 0; row < num_constrains + 2; ++row) {
+            for (size_t col = 0; col < columns; ++col) {
+                std::cout << at(row, col, lane) << " ";
+            }
+            std::cout << std::endl;
+        }
+    }
+    std::cout << std::endl;
+}
+#endif // PRINT
+
+#endif // __BATCHTABLEAU_HPP__
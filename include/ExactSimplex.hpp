@@ -0,0 +1,836 @@
+#ifndef __EXACTSIMPLEX_HPP__
+#define __EXACTSIMPLEX_HPP__
+
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Rational.hpp"
+
+
+template<typename T>
+struct LinearConstrainSystem;
+
+
+
+/**
+ * @brief class for the revised simplex in exact arithmetic, used by LinearConstrainSystem to verify
+ * and repair the final base of a floating-point optimization
+ *
+ * Every row i reads a*x + s_i = b for LE rows, a*x - s_i = b for GE rows and a*x = b for EQ rows,
+ * with an artificial variable added to every row with the sign of b. Variables are numbered as in
+ * LinearConstrainSystem::get_basis_variable: decisional variables, then the slack or surplus
+ * variable of every row, then the artificial variable of every row. The problem is always minimized.
+ *
+ * Floating-point values are fractions with a power of 2 as denominator: every row, and the objective
+ * function, is multiplied by the power of 2 making it integer, so that the whole computation is done
+ * on BigInteger. Numbers are kept times the determinant of the base matrix, which makes them integer.
+ *
+ * The final base of a floating-point simplex is almost always optimal, so it is verified first:
+ * B*x = b and y*B = c_B are solved once each by Bareiss' fraction-free elimination, and the base is
+ * certified if x and the reduced costs have the right signs. Only when this fails is the base
+ * repaired by exact pivots: the inverse of the base matrix is then kept as adjugate and determinant,
+ * both integer, and updated by every pivot with exact divisions by the previous determinant. Either
+ * way numbers grow no larger than the minors of the base matrix and no gcd is ever needed.
+ *
+ * Pricing and ratio tests of the repair follow Bland's rule, which cannot cycle; the repaired base
+ * is usually a few primal or dual pivots away from the floating-point one. Artificial variables
+ * never enter the base: out of the first phase they are fixed to 0, so those left in base by the
+ * floating-point simplex are accepted at value 0.
+ *
+ * @tparam T
+ */
+template<typename T>
+class ExactSimplex {
+
+    static const size_t NONE = std::numeric_limits<size_t>::max();     //!< variable not in base, or missing row
+
+    size_t num_variables{0};                                //!< number of decisional variables
+    size_t num_constrains{0};                               //!< number of constrains
+    std::vector<std::vector<std::pair<size_t, BigInteger>>> columns; //!< nonzero elements of the column of every variable, rows scaled
+    std::vector<bool> has_logical;                          //!< flag for rows with a slack or surplus variable, i.e. not EQ
+    std::vector<size_t> row_shift;                          //!< every row is multiplied by 2^row_shift
+    size_t cost_shift{0};                                   //!< the objective function is multiplied by 2^cost_shift
+    std::vector<BigInteger> b;                              //!< constant terms, rows scaled
+    std::vector<BigInteger> cost;                           //!< cost of every variable for minimization, scaled
+    std::vector<BigInteger> artificial_cost;                //!< cost of the artificial variable of every row in the first phase
+    std::vector<size_t> base;                               //!< variable in base in every row
+    std::vector<size_t> base_row;                           //!< row of every variable in base, NONE if not in base
+    std::vector<std::vector<BigInteger>> adjugate;          //!< inverse of the base matrix times determinant, used by the repair only
+    BigInteger determinant;                                 //!< determinant of the base matrix, up to its sign
+    std::vector<BigInteger> values;                         //!< value of the variable in base in every row, times determinant
+    std::vector<BigInteger> duals;                          //!< dual value of every row, times determinant
+    std::vector<BigInteger> alpha;                          //!< buffer for the inverse times the column of the entering variable, times determinant
+
+    // empty constructor
+    ExactSimplex() {}
+
+    /**
+     * @brief method to check whether a variable is an artificial variable
+     */
+    inline bool is_artificial(size_t variable) const { return variable >= num_variables + num_constrains; }
+    /**
+     * @brief method to check whether a variable can enter the base: it is not in base, not artificial
+     * and not the missing slack variable of an EQ row
+     */
+    inline bool can_enter(size_t variable) const {
+        return base_row[variable] == NONE && !is_artificial(variable) &&
+               (variable < num_variables || has_logical[variable - num_variables]);
+    }
+    /**
+     * @brief method to get the sign of a quantity stored times the determinant
+     */
+    inline int sign_of(const BigInteger& scaled) const { return scaled.sign() * determinant.sign(); }
+    /**
+     * @brief method to compare the fractions a/b and c/d, with b and d not 0
+     *
+     * @return 'int' -1, 0 or 1 as a/b is smaller, equal or greater than c/d
+     */
+    static inline int compare_fractions(const BigInteger& a, const BigInteger& b, const BigInteger& c, const BigInteger& d) {
+        return BigInteger::compare(a * d, c * b) * b.sign() * d.sign();
+    }
+
+    // method to build the columns of every variable from the constrain system
+    void load(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains, const std::vector<T>& c,
+              const typename LinearConstrainSystem<T>::OptimizationType type);
+    // method to solve the loaded system starting from a base
+    typename LinearConstrainSystem<T>::SolutionType solve(const std::vector<size_t>& start_base, size_t& pivots);
+    // method to solve a square system by fraction-free elimination
+    static bool solve_fraction_free(std::vector<std::vector<BigInteger>>& matrix, std::vector<BigInteger>& rhs, BigInteger& scale);
+    // method to certify a base as optimal or as proof of infeasibility without pivots
+    bool certify(const std::vector<size_t>& start_base, typename LinearConstrainSystem<T>::SolutionType& sol_type);
+    // method to repair a base by exact pivots
+    typename LinearConstrainSystem<T>::SolutionType repair(const std::vector<size_t>& start_base, size_t& pivots);
+    // method to set the base of artificial variables
+    void reset_base();
+    // method to bring the variables of a base into the current base
+    void enter_base(const std::vector<size_t>& start_base);
+    // method to compute the adjugate times the column of a variable
+    void compute_alpha(size_t variable);
+    // method to get the cost of a variable in a phase
+    const BigInteger& get_cost(size_t variable, bool first_phase) const;
+    // method to compute the dual values of the current base for a phase
+    void compute_duals(bool first_phase);
+    // method to compute the reduced cost of a variable
+    BigInteger reduced_cost(size_t variable, bool first_phase) const;
+    // method to bring a variable into the base in place of the variable of a row
+    void pivot(size_t row, size_t variable);
+    // method to check whether the basic solution is feasible
+    bool is_primal_feasible(bool first_phase) const;
+    // method to check whether no variable can enter the base with negative reduced cost
+    bool is_dual_feasible(bool first_phase);
+    // method to execute primal pivots until the base is optimal
+    typename LinearConstrainSystem<T>::SolutionType run_primal(bool first_phase, size_t& pivots);
+    // method to execute dual pivots until the base is feasible
+    typename LinearConstrainSystem<T>::SolutionType run_dual(size_t& pivots);
+    // method to write decisional variables and z
+    void get_solution(std::vector<Rational>& solution, const std::vector<T>& c) const;
+    // method to get the dual value of every constrain
+    void get_duals(std::vector<Rational>& row_duals, const typename LinearConstrainSystem<T>::OptimizationType type) const;
+    // method to get the variables of the base
+    void get_base(std::vector<size_t>& variables) const;
+
+    friend struct LinearConstrainSystem<T>;
+};
+
+
+template<typename T>
+const size_t ExactSimplex<T>::NONE;
+
+
+/**
+ * @brief method to build the columns of every variable from the constrain system
+ *
+ * Coefficients are converted to Rational exactly; every row is then multiplied by the largest
+ * denominator of its coefficients and constant term, a power of 2, and so is the objective function.
+ * Slack, surplus and artificial variables keep unit columns: they are scaled with their rows, which
+ * does not change their sign. The costs of artificial variables in the first phase undo their scaling,
+ * so that the first phase minimizes their sum as the floating-point feasibility test does.
+ *
+ * @tparam T
+ * @param constrains vector of Constrain objects to represent system constrains
+ * @param c objective function coefficients
+ * @param type optimization type
+ */
+template<typename T>
+void ExactSimplex<T>::load(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains, const std::vector<T>& c,
+                           const typename LinearConstrainSystem<T>::OptimizationType type) {
+
+    num_constrains = constrains.size();
+    num_variables = constrains[0].a.size();
+    size_t total = num_variables + 2 * num_constrains;
+    columns.assign(total, std::vector<std::pair<size_t, BigInteger>>());
+    has_logical.assign(num_constrains, false);
+    row_shift.assign(num_constrains, 0);
+    b.resize(num_constrains);
+    cost.assign(total, BigInteger());
+
+    // exact values of a row, the denominator of a Rational from a double is 2^shift
+    std::vector<Rational> exact_values(num_variables + 1);
+    auto shift_of = [](const Rational& value) { return value.denominator().bit_length() - 1; };
+    auto scaled = [&shift_of](const Rational& value, size_t shift) {
+        BigInteger numerator = value.numerator();
+        numerator <<= shift - shift_of(value);
+        return numerator;
+    };
+    for (size_t row = 0; row < num_constrains; ++row) {
+        const auto& constrain = constrains[row];
+        for (size_t j = 0; j < num_variables; ++j) {
+            exact_values[j] = Rational(static_cast<double>(constrain.a[j]));
+        }
+        exact_values[num_variables] = Rational(static_cast<double>(constrain.b));
+        for (const auto& value : exact_values) {
+            row_shift[row] = std::max(row_shift[row], shift_of(value));
+        }
+        for (size_t j = 0; j < num_variables; ++j) {
+            if (!exact_values[j].is_zero()) {
+                columns[j].emplace_back(row, scaled(exact_values[j], row_shift[row]));
+            }
+        }
+        b[row] = scaled(exact_values[num_variables], row_shift[row]);
+        if (constrain.type != LinearConstrainSystem<T>::ConstrainType::EQ) {
+            has_logical[row] = true;
+            columns[num_variables + row].emplace_back(row, BigInteger(constrain.type == LinearConstrainSystem<T>::ConstrainType::LE ? 1 : -1));
+        }
+        columns[num_variables + num_constrains + row].emplace_back(row, BigInteger(b[row].sign() < 0 ? -1 : 1));
+    }
+
+    size_t max_shift = *std::max_element(row_shift.begin(), row_shift.end());
+    artificial_cost.resize(num_constrains);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        artificial_cost[row] = BigInteger(1);
+        artificial_cost[row] <<= max_shift - row_shift[row];
+    }
+
+    // the problem is always minimized: maximization coefficients change sign
+    cost_shift = 0;
+    exact_values.resize(num_variables);
+    for (size_t j = 0; j < num_variables; ++j) {
+        exact_values[j] = Rational(static_cast<double>(c[j]));
+        cost_shift = std::max(cost_shift, shift_of(exact_values[j]));
+    }
+    for (size_t j = 0; j < num_variables; ++j) {
+        cost[j] = scaled(exact_values[j], cost_shift);
+        if (type == LinearConstrainSystem<T>::OptimizationType::MAX) {
+            cost[j] = -cost[j];
+        }
+    }
+}
+
+
+/**
+ * @brief method to set the base of artificial variables, whose basic solution is |b|
+ *
+ * @tparam T
+ */
+template<typename T>
+void ExactSimplex<T>::reset_base() {
+
+    size_t first_artificial = num_variables + num_constrains;
+    base.resize(num_constrains);
+    base_row.assign(columns.size(), NONE);
+    // the base matrix is diagonal with elements +-1: it is its own inverse
+    determinant = BigInteger(1);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        if (b[row].sign() < 0) {
+            determinant = -determinant;
+        }
+    }
+    adjugate.assign(num_constrains, std::vector<BigInteger>(num_constrains));
+    values.resize(num_constrains);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        base[row] = first_artificial + row;
+        base_row[first_artificial + row] = row;
+        adjugate[row][row] = columns[first_artificial + row][0].second * determinant;
+        values[row] = (b[row].sign() < 0 ? -b[row] : b[row]) * determinant;
+    }
+}
+
+
+/**
+ * @brief method to bring the variables of a base into the base of artificial variables, as
+ * Tableau::reinvert does: artificial variables of the base keep their rows, every other variable
+ * takes a free row with a nonzero element. Variables out of range, repeated or dependent on the
+ * previous ones are skipped, leaving artificial variables in their rows.
+ *
+ * @tparam T
+ * @param start_base variables of the base
+ */
+template<typename T>
+void ExactSimplex<T>::enter_base(const std::vector<size_t>& start_base) {
+
+    std::vector<bool> taken(num_constrains, false);
+    for (size_t variable : start_base) {
+        if (variable < columns.size() && is_artificial(variable)) {
+            taken[base_row[variable]] = true;
+        }
+    }
+    for (size_t variable : start_base) {
+        if (variable >= columns.size() || base_row[variable] != NONE || columns[variable].empty()) {
+            continue;
+        }
+        compute_alpha(variable);
+        size_t pivot_row = NONE;
+        for (size_t row = 0; row < num_constrains && pivot_row == NONE; ++row) {
+            if (!taken[row] && !alpha[row].is_zero()) {
+                pivot_row = row;
+            }
+        }
+        if (pivot_row != NONE) {
+            pivot(pivot_row, variable);
+            taken[pivot_row] = true;
+        }
+    }
+}
+
+
+/**
+ * @brief method to compute the adjugate times the column of a variable, in alpha
+ *
+ * @tparam T
+ * @param variable index of the variable
+ */
+template<typename T>
+void ExactSimplex<T>::compute_alpha(size_t variable) {
+
+    alpha.assign(num_constrains, BigInteger());
+    for (const auto& element : columns[variable]) {
+        for (size_t row = 0; row < num_constrains; ++row) {
+            const BigInteger& factor = adjugate[row][element.first];
+            if (!factor.is_zero()) {
+                alpha[row] += factor * element.second;
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief method to get the cost of a variable in a phase
+ *
+ * @tparam T
+ * @param variable index of the variable
+ * @param first_phase true for the costs of the first phase: positive for artificial variables, 0 otherwise
+ * @return 'const BigInteger&' scaled cost
+ */
+template<typename T>
+const BigInteger& ExactSimplex<T>::get_cost(size_t variable, bool first_phase) const {
+
+    static const BigInteger zero;
+    if (!first_phase) {
+        return cost[variable];
+    }
+    return is_artificial(variable) ? artificial_cost[variable - num_variables - num_constrains] : zero;
+}
+
+
+/**
+ * @brief method to compute the dual values of the current base, the costs of the variables in base
+ * times the adjugate
+ *
+ * @tparam T
+ * @param first_phase true for the costs of the first phase
+ */
+template<typename T>
+void ExactSimplex<T>::compute_duals(bool first_phase) {
+
+    duals.assign(num_constrains, BigInteger());
+    for (size_t row = 0; row < num_constrains; ++row) {
+        const BigInteger& base_cost = get_cost(base[row], first_phase);
+        if (base_cost.is_zero()) {
+            continue;
+        }
+        for (size_t k = 0; k < num_constrains; ++k) {
+            if (!adjugate[row][k].is_zero()) {
+                duals[k] += base_cost * adjugate[row][k];
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief method to compute the reduced cost of a variable from the dual values in duals
+ *
+ * @tparam T
+ * @param variable index of the variable
+ * @param first_phase true for the costs of the first phase
+ * @return 'BigInteger' cost of the variable minus the dual values times its column, times determinant
+ */
+template<typename T>
+BigInteger ExactSimplex<T>::reduced_cost(size_t variable, bool first_phase) const {
+
+    BigInteger result = get_cost(variable, first_phase) * determinant;
+    for (const auto& element : columns[variable]) {
+        if (!duals[element.first].is_zero()) {
+            result -= duals[element.first] * element.second;
+        }
+    }
+    return result;
+}
+
+
+/**
+ * @brief method to bring a variable into the base in place of the variable of a row, updating the
+ * adjugate and the basic solution; alpha must hold the column of the variable
+ *
+ * The new determinant is the element of alpha in the pivot row: the other rows are combined with the
+ * pivot row and divided by the old determinant, which is exact.
+ *
+ * @tparam T
+ * @param row row of the leaving variable
+ * @param variable index of the entering variable
+ */
+template<typename T>
+void ExactSimplex<T>::pivot(size_t row, size_t variable) {
+
+    const BigInteger pivot_element = alpha[row];
+    for (size_t other = 0; other < num_constrains; ++other) {
+        if (other == row) {
+            continue;
+        }
+        const BigInteger& factor = alpha[other];
+        for (size_t k = 0; k < num_constrains; ++k) {
+            BigInteger& element = adjugate[other][k];
+            if (factor.is_zero() || adjugate[row][k].is_zero()) {
+                if (!element.is_zero()) {
+                    element = element * pivot_element / determinant;
+                }
+            } else {
+                element = (element * pivot_element - factor * adjugate[row][k]) / determinant;
+            }
+        }
+        values[other] = (values[other] * pivot_element - factor * values[row]) / determinant;
+    }
+    determinant = pivot_element;
+    base_row[base[row]] = NONE;
+    base[row] = variable;
+    base_row[variable] = row;
+}
+
+
+/**
+ * @brief method to check whether the basic solution is feasible: no negative value and, out of the
+ * first phase, artificial variables at 0
+ *
+ * @tparam T
+ * @param first_phase true to accept positive artificial variables
+ * @return true if the basic solution is feasible
+ */
+template<typename T>
+bool ExactSimplex<T>::is_primal_feasible(bool first_phase) const {
+
+    for (size_t row = 0; row < num_constrains; ++row) {
+        int value_sign = sign_of(values[row]);
+        if (value_sign < 0 || (value_sign > 0 && !first_phase && is_artificial(base[row]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief method to check whether no variable can enter the base with negative reduced cost
+ *
+ * @tparam T
+ * @param first_phase true for the costs of the first phase
+ * @return true if the base is dual feasible
+ */
+template<typename T>
+bool ExactSimplex<T>::is_dual_feasible(bool first_phase) {
+
+    compute_duals(first_phase);
+    for (size_t variable = 0; variable < columns.size(); ++variable) {
+        if (can_enter(variable) && sign_of(reduced_cost(variable, first_phase)) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief method to execute primal pivots, from a feasible base, until no variable can enter it
+ *
+ * The entering variable is the first one with negative reduced cost, the leaving one the first of
+ * the minimum ratio. Out of the first phase, artificial variables in base are fixed to 0: a row
+ * holding one limits the entering variable to 0 whatever the sign of its element.
+ *
+ * @tparam T
+ * @param first_phase true to minimize the sum of artificial variables
+ * @param pivots counter of the pivots
+ * @return BOUNDED if the base is optimal, UNBOUNDED if the entering variable can grow without limit
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType ExactSimplex<T>::run_primal(bool first_phase, size_t& pivots) {
+
+    const BigInteger zero, one(1);
+    while (true) {
+        compute_duals(first_phase);
+        size_t entering = NONE;
+        for (size_t variable = 0; variable < columns.size() && entering == NONE; ++variable) {
+            if (can_enter(variable) && sign_of(reduced_cost(variable, first_phase)) < 0) {
+                entering = variable;
+            }
+        }
+        if (entering == NONE) {
+            return LinearConstrainSystem<T>::SolutionType::BOUNDED;
+        }
+        compute_alpha(entering);
+        // ratios are values / alpha, the determinant cancels out
+        size_t leaving_row = NONE;
+        const BigInteger* min_numerator = nullptr;
+        const BigInteger* min_denominator = nullptr;
+        for (size_t row = 0; row < num_constrains; ++row) {
+            bool fixed = !first_phase && is_artificial(base[row]);
+            if (alpha[row].is_zero() || (!fixed && sign_of(alpha[row]) < 0)) {
+                continue;
+            }
+            const BigInteger* numerator = fixed ? &zero : &values[row];
+            const BigInteger* denominator = fixed ? &one : &alpha[row];
+            int comparison = (leaving_row == NONE) ? -1 : compare_fractions(*numerator, *denominator, *min_numerator, *min_denominator);
+            if (comparison < 0 || (comparison == 0 && base[row] < base[leaving_row])) {
+                leaving_row = row;
+                min_numerator = numerator;
+                min_denominator = denominator;
+            }
+        }
+        if (leaving_row == NONE) {
+            return LinearConstrainSystem<T>::SolutionType::UNBOUNDED;
+        }
+        pivot(leaving_row, entering);
+        ++pivots;
+    }
+}
+
+
+/**
+ * @brief method to execute dual pivots, from a dual feasible base, until the basic solution is feasible
+ *
+ * The leaving variable is the first infeasible one: negative, or a positive artificial variable, which
+ * leaves towards 0 from above. The entering variable keeps the reduced costs nonnegative, the first
+ * of the minimum ratio.
+ *
+ * @tparam T
+ * @param pivots counter of the pivots
+ * @return BOUNDED if the base is optimal, INFEASIBLE if no variable can enter the base
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType ExactSimplex<T>::run_dual(size_t& pivots) {
+
+    while (true) {
+        size_t leaving_row = NONE;
+        for (size_t row = 0; row < num_constrains; ++row) {
+            int value_sign = sign_of(values[row]);
+            if ((value_sign < 0 || (value_sign > 0 && is_artificial(base[row]))) &&
+                (leaving_row == NONE || base[row] < base[leaving_row])) {
+                leaving_row = row;
+            }
+        }
+        if (leaving_row == NONE) {
+            return LinearConstrainSystem<T>::SolutionType::BOUNDED;
+        }
+        // sign of the elements of the leaving row allowing the entering variable to grow
+        int direction = sign_of(values[leaving_row]);
+        compute_duals(false);
+        // ratios are reduced cost / |element|, the determinant cancels out
+        size_t entering = NONE;
+        BigInteger min_numerator, min_denominator;
+        for (size_t variable = 0; variable < columns.size(); ++variable) {
+            if (!can_enter(variable)) {
+                continue;
+            }
+            BigInteger element;
+            for (const auto& nonzero : columns[variable]) {
+                if (!adjugate[leaving_row][nonzero.first].is_zero()) {
+                    element += adjugate[leaving_row][nonzero.first] * nonzero.second;
+                }
+            }
+            if (element.is_zero() || sign_of(element) != direction) {
+                continue;
+            }
+            BigInteger numerator = reduced_cost(variable, false);
+            if (direction < 0) {
+                numerator = -numerator;
+            }
+            if (entering == NONE || compare_fractions(numerator, element, min_numerator, min_denominator) < 0) {
+                entering = variable;
+                min_numerator = numerator;
+                min_denominator = element;
+            }
+        }
+        if (entering == NONE) {
+            return LinearConstrainSystem<T>::SolutionType::INFEASIBLE;
+        }
+        compute_alpha(entering);
+        pivot(leaving_row, entering);
+        ++pivots;
+    }
+}
+
+
+/**
+ * @brief method to solve the loaded system starting from a base, e.g. the final base of a
+ * floating-point simplex: the base is certified if possible, repaired by exact pivots otherwise
+ *
+ * @tparam T
+ * @param start_base variables of the starting base, see LinearConstrainSystem::get_basis_variable
+ * @param pivots counter of the pivots
+ * @return LinearConstrainSystem<T>::SolutionType exact result
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType ExactSimplex<T>::solve(const std::vector<size_t>& start_base, size_t& pivots) {
+
+    typename LinearConstrainSystem<T>::SolutionType sol_type;
+    if (certify(start_base, sol_type)) {
+        return sol_type;
+    }
+    sol_type = repair(start_base, pivots);
+    if (sol_type == LinearConstrainSystem<T>::SolutionType::BOUNDED) {
+        compute_duals(false);
+    }
+    return sol_type;
+}
+
+
+/**
+ * @brief method to solve matrix * x = rhs by Bareiss' fraction-free elimination, with row exchanges
+ *
+ * Every element computed by the elimination is a minor of the matrix, and every division is exact.
+ * The last pivot is the determinant of the matrix, up to its sign: x times it is integer, as by
+ * Cramer's rule, and so is every step of the back substitution.
+ *
+ * @param matrix square matrix, overwritten by the elimination
+ * @param rhs constant terms, overwritten by x times scale
+ * @param scale where the determinant of the matrix, up to its sign, is written
+ * @return false if the matrix is singular
+ */
+template<typename T>
+bool ExactSimplex<T>::solve_fraction_free(std::vector<std::vector<BigInteger>>& matrix, std::vector<BigInteger>& rhs,
+                                          BigInteger& scale) {
+
+    size_t size = rhs.size();
+    BigInteger previous(1);
+    for (size_t k = 0; k < size; ++k) {
+        size_t pivot_row = k;
+        while (pivot_row < size && matrix[pivot_row][k].is_zero()) {
+            ++pivot_row;
+        }
+        if (pivot_row == size) {
+            return false;
+        }
+        std::swap(matrix[k], matrix[pivot_row]);
+        std::swap(rhs[k], rhs[pivot_row]);
+        const BigInteger& pivot_element = matrix[k][k];
+        for (size_t row = k + 1; row < size; ++row) {
+            const BigInteger& factor = matrix[row][k];
+            for (size_t j = k + 1; j < size; ++j) {
+                BigInteger& element = matrix[row][j];
+                if (factor.is_zero() || matrix[k][j].is_zero()) {
+                    if (!element.is_zero()) {
+                        element = element * pivot_element / previous;
+                    }
+                } else {
+                    element = (element * pivot_element - factor * matrix[k][j]) / previous;
+                }
+            }
+            rhs[row] = (rhs[row] * pivot_element - factor * rhs[k]) / previous;
+        }
+        previous = pivot_element;
+    }
+    scale = previous;
+    for (size_t k = size; k-- > 0;) {
+        BigInteger sum = rhs[k] * scale;
+        for (size_t j = k + 1; j < size; ++j) {
+            if (!matrix[k][j].is_zero() && !rhs[j].is_zero()) {
+                sum -= matrix[k][j] * rhs[j];
+            }
+        }
+        rhs[k] = sum / matrix[k][k];
+    }
+    return true;
+}
+
+
+/**
+ * @brief method to certify a base without pivots: as optimal if both primal and dual feasible, or as
+ * proof of infeasibility if feasible with a positive artificial variable and minimizing their sum
+ *
+ * The basic solution and the dual values are computed by one fraction-free elimination each. On
+ * success they are left in values and duals, the latter for the costs of the second phase.
+ *
+ * @tparam T
+ * @param start_base variables of the base, see LinearConstrainSystem::get_basis_variable
+ * @param sol_type where BOUNDED or INFEASIBLE is written if the base is certified
+ * @return false if the base is not valid, not feasible or not optimal
+ */
+template<typename T>
+bool ExactSimplex<T>::certify(const std::vector<size_t>& start_base, typename LinearConstrainSystem<T>::SolutionType& sol_type) {
+
+    if (start_base.size() != num_constrains) {
+        return false;
+    }
+    base.assign(start_base.begin(), start_base.end());
+    base_row.assign(columns.size(), NONE);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        size_t variable = base[row];
+        if (variable >= columns.size() || base_row[variable] != NONE || columns[variable].empty()) {
+            return false;
+        }
+        base_row[variable] = row;
+    }
+
+    // B * x = b
+    std::vector<std::vector<BigInteger>> matrix(num_constrains, std::vector<BigInteger>(num_constrains));
+    for (size_t k = 0; k < num_constrains; ++k) {
+        for (const auto& element : columns[base[k]]) {
+            matrix[element.first][k] = element.second;
+        }
+    }
+    values = b;
+    if (!solve_fraction_free(matrix, values, determinant)) {
+        return false;
+    }
+    bool first_phase = false;
+    for (size_t row = 0; row < num_constrains; ++row) {
+        int value_sign = sign_of(values[row]);
+        if (value_sign < 0) {
+            return false;
+        }
+        first_phase = first_phase || (value_sign > 0 && is_artificial(base[row]));
+    }
+
+    // y * B = c_B, the determinant of the transpose is the same up to its sign
+    for (size_t k = 0; k < num_constrains; ++k) {
+        matrix[k].assign(num_constrains, BigInteger());
+        for (const auto& element : columns[base[k]]) {
+            matrix[k][element.first] = element.second;
+        }
+    }
+    duals.resize(num_constrains);
+    for (size_t k = 0; k < num_constrains; ++k) {
+        duals[k] = get_cost(base[k], first_phase);
+    }
+    BigInteger scale;
+    solve_fraction_free(matrix, duals, scale);
+    if (scale.sign() != determinant.sign()) {
+        for (auto& dual : duals) {
+            dual = -dual;
+        }
+    }
+    for (size_t variable = 0; variable < columns.size(); ++variable) {
+        if (can_enter(variable) && sign_of(reduced_cost(variable, first_phase)) < 0) {
+            return false;
+        }
+    }
+    sol_type = first_phase ? LinearConstrainSystem<T>::SolutionType::INFEASIBLE : LinearConstrainSystem<T>::SolutionType::BOUNDED;
+    return true;
+}
+
+
+/**
+ * @brief method to repair a base that certify has rejected, by exact pivots
+ *
+ * The variables of the base enter the base of artificial variables. A primal feasible base is then
+ * repaired by primal pivots, a dual feasible one by dual pivots, a base feasible for the first phase
+ * by both phases; any other base is dropped for the base of artificial variables.
+ *
+ * @tparam T
+ * @param start_base variables of the starting base, see LinearConstrainSystem::get_basis_variable
+ * @param pivots counter of the pivots
+ * @return LinearConstrainSystem<T>::SolutionType exact result
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType ExactSimplex<T>::repair(const std::vector<size_t>& start_base, size_t& pivots) {
+
+    reset_base();
+    enter_base(start_base);
+    if (is_primal_feasible(false)) {
+        return run_primal(false, pivots);
+    }
+    // some artificial variable is positive, and no pivot of the first phase can decrease it
+    bool first_phase_feasible = is_primal_feasible(true);
+    if (first_phase_feasible && is_dual_feasible(true)) {
+        return LinearConstrainSystem<T>::SolutionType::INFEASIBLE;
+    }
+    if (is_dual_feasible(false)) {
+        return run_dual(pivots);
+    }
+    if (!first_phase_feasible) {
+        reset_base();
+    }
+    run_primal(true, pivots);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        if (is_artificial(base[row]) && sign_of(values[row]) > 0) {
+            return LinearConstrainSystem<T>::SolutionType::INFEASIBLE;
+        }
+    }
+    return run_primal(false, pivots);
+}
+
+
+/**
+ * @brief method to write decisional variables and z of the current base
+ *
+ * @tparam T
+ * @param solution vector where decisional variables and z are written
+ * @param c objective function coefficients
+ */
+template<typename T>
+void ExactSimplex<T>::get_solution(std::vector<Rational>& solution, const std::vector<T>& c) const {
+
+    solution.assign(num_variables + 1, Rational());
+    for (size_t row = 0; row < num_constrains; ++row) {
+        if (base[row] < num_variables && !values[row].is_zero()) {
+            solution[base[row]] = Rational(values[row], determinant);
+        }
+    }
+    for (size_t j = 0; j < num_variables; ++j) {
+        if (!solution[j].is_zero() && c[j] != 0) {
+            solution[num_variables] += Rational(static_cast<double>(c[j])) * solution[j];
+        }
+    }
+}
+
+
+/**
+ * @brief method to get the dual value of every constrain of the optimal base, with the convention
+ * of LinearConstrainSystem::get_duals; the scaling of rows and objective function is undone
+ *
+ * @tparam T
+ * @param row_duals vector where the dual value of every constrain is written
+ * @param type optimization type
+ */
+template<typename T>
+void ExactSimplex<T>::get_duals(std::vector<Rational>& row_duals, const typename LinearConstrainSystem<T>::OptimizationType type) const {
+
+    BigInteger denominator = determinant;
+    denominator <<= cost_shift;
+    if (type == LinearConstrainSystem<T>::OptimizationType::MAX) {
+        denominator = -denominator;
+    }
+    row_duals.resize(num_constrains);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        BigInteger numerator = duals[row];
+        numerator <<= row_shift[row];
+        row_duals[row] = Rational(numerator, denominator);
+    }
+}
+
+
+/**
+ * @brief method to get the variables of the current base
+ *
+ * @tparam T
+ * @param variables vector where the variable in base in every row is written
+ */
+template<typename T>
+void ExactSimplex<T>::get_base(std::vector<size_t>& variables) const {
+
+    variables.assign(base.begin(), base.end());
+}
+
+#endif // __EXACTSIMPLEX_HPP__
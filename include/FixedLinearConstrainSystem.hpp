@@ -0,0 +1,240 @@
+#ifndef __FIXEDLINEARCONSTRAINSYSTEM_HPP__
+#define __FIXEDLINEARCONSTRAINSYSTEM_HPP__
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include "LinearConstrainSystem.hpp"
+#include "FixedTableau.hpp"
+
+
+/**
+ * @brief Struct to represent a linear constrain system with at most M constrains and N variables,
+ * both known at compile time
+ *
+ * It offers the same methods and enums of LinearConstrainSystem<T>, but constrains and tableau are
+ * stored in std::array: copying the system, checking feasibility and optimizing never allocate when
+ * the std::array overloads are used. The std::vector overloads copy into the arrays, and allocate
+ * only to grow the solution vector. Meant for very small problems solved many times, where heap
+ * allocations cost more than the arithmetic. Steps are printed only when PRINT is defined.
+ *
+ * @tparam T is the parametric type
+ * @tparam M maximum number of constrains
+ * @tparam N number of decisional variables
+ */
+template<typename T, size_t M, size_t N>
+struct FixedLinearConstrainSystem {
+
+    typedef typename LinearConstrainSystem<T>::SolutionType SolutionType;
+    typedef typename LinearConstrainSystem<T>::ConstrainType ConstrainType;
+    typedef typename LinearConstrainSystem<T>::OptimizationType OptimizationType;
+
+    /**
+     * @brief struct representing a constrain
+    */
+    struct Constrain {
+        std::array<T, N> a; //!< constrain coefficients
+        T b;                //!< constant term
+        ConstrainType type; //!< constrain type
+    };
+
+    /**
+     * @brief empty constructor
+     */
+    FixedLinearConstrainSystem() {}
+
+    /**
+     * @brief Add constrain a*x type b, e.g., a*x <= b
+     *
+     * @param a constrain coefficients
+     * @param b known term
+     * @param type constrain type
+     */
+    inline FixedLinearConstrainSystem& add_constrain(const std::array<T, N>& a, const T& b, const ConstrainType type) {
+        if (num_constrains == M) {
+            throw std::invalid_argument("Too many constrains for the system size");
+        }
+        constrains[num_constrains].a = a;
+        constrains[num_constrains].b = b;
+        constrains[num_constrains].type = type;
+        ++num_constrains;
+        feasibility_test = false;
+        return *this;
+    }
+
+    /**
+     * @brief Add constrain a*x type b with the signature of LinearConstrainSystem<T>::add_constrain;
+     * a is copied into the system without allocations
+     *
+     * Braced lists are not deduced as std::vector<T, Allocator>, so they keep selecting the std::array overload.
+     *
+     * @param a constrain coefficients, N of them
+     * @param b known term
+     * @param type constrain type
+     */
+    template<typename Allocator>
+    inline FixedLinearConstrainSystem& add_constrain(const std::vector<T, Allocator>& a, const T& b, const ConstrainType type) {
+        // verifying that the number of decisional variables coefficients is equal to number of decisional variables
+        if (a.size() != N) {
+            throw std::invalid_argument("Wrong number of variables in constrain");
+        }
+        if (num_constrains == M) {
+            throw std::invalid_argument("Too many constrains for the system size");
+        }
+        std::copy(a.begin(), a.end(), constrains[num_constrains].a.begin());
+        constrains[num_constrains].b = b;
+        constrains[num_constrains].type = type;
+        ++num_constrains;
+        feasibility_test = false;
+        return *this;
+    }
+
+    // method to check if the system is feasible
+    bool is_feasible();
+    // method to optimize c*x with respect to the constrain system with x, without allocations
+    SolutionType optimize(std::array<T, N + 1>& solution, const std::array<T, N>& c, const OptimizationType type);
+    // method to optimize c*x with the same signature of LinearConstrainSystem<T>::optimize
+    SolutionType optimize(std::vector<T>& solution, const std::vector<T>& c, const OptimizationType type);
+
+  private:
+
+    std::array<Constrain, M> constrains;   //!< array containing objects of type Constrain
+    size_t num_constrains{0};              //!< number of constrains added so far
+    FixedTableau<T, M, N> tab;             //!< object of the struct FixedTableau
+    bool feasibility_test{false};          //!< flag to keep track whether the user has already executed the is_feasible method for a constrain system
+
+    // method to execute the pivot method until it gets interrupted
+    SolutionType run_simplex();
+};
+
+
+/**
+ * @brief method to execute pivot method on tableau until no variable can enter the base
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @return BOUNDED or UNBOUNDED
+ */
+template<typename T, size_t M, size_t N>
+typename FixedLinearConstrainSystem<T, M, N>::SolutionType FixedLinearConstrainSystem<T, M, N>::run_simplex() {
+
+    int pivot_column = tab.find_pivot_column();
+    while (pivot_column != -1) {
+        int pivot_row = tab.find_pivot_row(pivot_column);
+        if (pivot_row == -1) {
+            return SolutionType::UNBOUNDED;
+        }
+        tab.pivot(pivot_row, pivot_column);
+        pivot_column = tab.find_pivot_column();
+    }
+    return SolutionType::BOUNDED;
+}
+
+
+/**
+ * @brief method to establish if the constrain system is feasible: the Big-M method is run with a null
+ * objective function and the system is infeasible if an artificial variable stays positive
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @return true if the system is feasible, otherwise InfeasibleSystemError is thrown
+ */
+template<typename T, size_t M, size_t N>
+bool FixedLinearConstrainSystem<T, M, N>::is_feasible() {
+
+    if (num_constrains == 0) {
+        throw std::invalid_argument("The constrain system is empty");
+    }
+    std::array<T, N> c;
+    c.fill(0);
+    tab.create_initial_tableau(constrains, num_constrains);
+    tab.add_objFunc_tableau(c, OptimizationType::MAX);
+    run_simplex();
+    if (tab.has_positive_artificial()) {
+        throw InfeasibleSystemError();
+    }
+    #ifdef PRINT
+    std::cout << "The system is FEASIBLE!" << std::endl << std::endl;
+    #endif // PRINT
+    feasibility_test = true;
+    return true;
+}
+
+
+/**
+ * @brief method to optimize c*x executing pivot method on tableau
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @param solution decisional variables followed by the optimal value z
+ * @param c objective function coefficients
+ * @param type optimization type
+ * @return FixedLinearConstrainSystem<T, M, N>::SolutionType
+ */
+template<typename T, size_t M, size_t N>
+typename FixedLinearConstrainSystem<T, M, N>::SolutionType FixedLinearConstrainSystem<T, M, N>::optimize(std::array<T, N + 1>& solution,
+                                                                                                        const std::array<T, N>& c,
+                                                                                                        const OptimizationType type) {
+
+    // if user has not executed is_feasible then do it
+    if (feasibility_test == false) {
+        is_feasible();
+    }
+    tab.create_initial_tableau(constrains, num_constrains);
+    tab.add_objFunc_tableau(c, type);
+    SolutionType sol_type = run_simplex();
+    if (sol_type == SolutionType::UNBOUNDED) {
+        return sol_type;
+    }
+
+    // writing decisional variables in base, all the others are 0
+    solution.fill(0);
+    for (size_t row = 0; row < M; ++row) {
+        if (tab.base[row] >= tab.DECVARS_INDEX) {
+            solution[tab.base[row] - tab.DECVARS_INDEX] = tab.tableau[row][tab.COLUMNS - 1];
+        }
+    }
+    // the constant term of objective function row is -z of the minimization
+    T z = tab.tableau[M][tab.COLUMNS - 1];
+    solution[N] = (type == OptimizationType::MAX) ? z : -z;
+    return sol_type;
+}
+
+
+/**
+ * @brief method to optimize c*x with the same signature of LinearConstrainSystem<T>::optimize;
+ * solution is resized to N + 1, which allocates only if its capacity is smaller
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @param solution vector containing solution
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @return FixedLinearConstrainSystem<T, M, N>::SolutionType
+ */
+template<typename T, size_t M, size_t N>
+typename FixedLinearConstrainSystem<T, M, N>::SolutionType FixedLinearConstrainSystem<T, M, N>::optimize(std::vector<T>& solution,
+                                                                                                        const std::vector<T>& c,
+                                                                                                        const OptimizationType type) {
+
+    // verifying that the number of decisional variables coefficients is equal to number of decisional variables
+    if (c.size() != N) {
+        throw std::invalid_argument("Wrong number of variables in objective function");
+    }
+    std::array<T, N> c_array;
+    std::copy(c.begin(), c.end(), c_array.begin());
+    std::array<T, N + 1> solution_array;
+    SolutionType sol_type = optimize(solution_array, c_array, type);
+    if (sol_type == SolutionType::BOUNDED) {
+        solution.assign(solution_array.begin(), solution_array.end());
+    }
+    return sol_type;
+}
+
+#endif // __FIXEDLINEARCONSTRAINSYSTEM_HPP__
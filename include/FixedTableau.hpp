@@ -0,0 +1,328 @@
+#ifndef __FIXEDTABLEAU_HPP__
+#define __FIXEDTABLEAU_HPP__
+
+
+#include <array>
+#include <iostream>
+#include <limits>
+
+#include "LinearConstrainSystem.hpp"
+
+
+template<typename T, size_t M, size_t N>
+struct FixedLinearConstrainSystem;
+
+
+
+/**
+ * @brief class for a Tableau whose dimensions are known at compile time
+ *
+ * Storage is made of std::array only, so building and solving the tableau never allocates.
+ * Columns have a fixed layout: row i owns columns 2i (slack or artificial variable) and 2i+1
+ * (surplus variable), decisional variables follow and the constant term is the last column.
+ * Unused columns stay 0 and rows of constrains not added yet are the trivial constrain 0 <= 0,
+ * so every loop runs over compile-time bounds and can be unrolled by the compiler.
+ *
+ * @tparam T is the parametric type
+ * @tparam M maximum number of constrains
+ * @tparam N number of decisional variables
+ */
+template<typename T, size_t M, size_t N>
+class FixedTableau {
+
+    static const size_t ROWS = M + 2;              //!< constrain rows plus objective function row and its Big-M part
+    static const size_t COLUMNS = 2 * M + N + 1;   //!< additional variables, decisional variables and constant term
+    static const size_t DECVARS_INDEX = 2 * M;     //!< index of the first decisional variable column
+
+    std::array<std::array<T, COLUMNS>, ROWS> tableau;   //!< tableau matrix
+    std::array<size_t, M> base;                         //!< vector for base variable index
+    std::array<bool, 2 * M> artificial;                 //!< true for columns of artificial variables
+    T tolerance = std::numeric_limits<T>::epsilon() * 1024; //!< values whose magnitude is below tolerance are treated as 0
+    T cost_tolerance = tolerance;       //!< tolerance of real parts of reduced costs, scaled by add_objFunc_tableau
+    T big_M_tolerance = tolerance;      //!< tolerance of M parts of reduced costs, scaled by add_objFunc_tableau
+
+    // empty constructor
+    FixedTableau() {}
+
+    // method to add system constrains in tableau
+    void create_initial_tableau(const std::array<typename FixedLinearConstrainSystem<T, M, N>::Constrain, M>& constrains, size_t num_constrains);
+    // method to add objective function rows with "Big-M" method
+    void add_objFunc_tableau(const std::array<T, N>& c, const typename LinearConstrainSystem<T>::OptimizationType type);
+    // method to identify base entering variable
+    int find_pivot_column() const;
+    // method to identify base exiting variable
+    int find_pivot_row(int pivot_column) const;
+    // method to perform pivot operation
+    void pivot(int pivot_row, int pivot_column);
+    // method to set to 0 the M parts of reduced costs within tolerance
+    void clear_big_M_noise();
+    // method to check whether an artificial variable is left in base with positive value
+    bool has_positive_artificial() const;
+
+    #ifdef PRINT
+    /**
+     * @brief method to print the tableau
+    */
+    void print_tableau() const;
+    #endif // PRINT
+
+    friend struct FixedLinearConstrainSystem<T, M, N>;
+};
+
+
+/**
+ * @brief method to add system constrains in tableau
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @param constrains array of Constrain objects to represent system constrains
+ * @param num_constrains number of constrains actually added to the system
+ */
+template<typename T, size_t M, size_t N>
+void FixedTableau<T, M, N>::create_initial_tableau(const std::array<typename FixedLinearConstrainSystem<T, M, N>::Constrain, M>& constrains,
+                                                   size_t num_constrains) {
+
+    typedef typename LinearConstrainSystem<T>::ConstrainType ConstrainType;
+
+    for (auto& row : tableau) {
+        row.fill(0);
+    }
+    artificial.fill(false);
+
+    for (size_t i = 0; i < M; ++i) {
+        // column of the variable placed in base for this row
+        size_t column = 2 * i;
+        base[i] = column;
+        // rows of constrains not added are 0 <= 0 with their slack variable in base
+        if (i >= num_constrains) {
+            tableau[i][column] = 1;
+            continue;
+        }
+
+        const auto& constrain = constrains[i];
+        // rows with negative constant term are multiplied by -1, turning LE into GE and vice versa
+        T sign = (constrain.b < 0) ? -1 : 1;
+        bool is_LE = constrain.type == ConstrainType::LE ? constrain.b >= 0 : constrain.type == ConstrainType::GE && constrain.b < 0;
+
+        // slack variable (LE) or artificial variable (GE, EQ)
+        tableau[i][column] = 1;
+        if (!is_LE) {
+            artificial[column] = true;
+        }
+        // surplus variable (GE)
+        if (!is_LE && constrain.type != ConstrainType::EQ) {
+            tableau[i][column + 1] = -1;
+        }
+        // inserting coefficients of vector a in correct position
+        for (size_t j = 0; j < N; ++j) {
+            tableau[i][DECVARS_INDEX + j] = sign * constrain.a[j];
+        }
+        // adding constant term
+        tableau[i][COLUMNS - 1] = sign * constrain.b;
+    }
+}
+
+
+/**
+ * @brief method to add objective function rows with "Big-M" method: as in Tableau<T>,
+ * row M holds the real costs and row M + 1 the coefficients of M
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @param c array of objective function coefficients
+ * @param type optimization type
+ */
+template<typename T, size_t M, size_t N>
+void FixedTableau<T, M, N>::add_objFunc_tableau(const std::array<T, N>& c, const typename LinearConstrainSystem<T>::OptimizationType type) {
+
+    std::array<T, COLUMNS>& obj = tableau[M];
+    std::array<T, COLUMNS>& big_M = tableau[M + 1];
+    // the tableau always minimizes: maximization uses opposite coefficients
+    T sign = (type == LinearConstrainSystem<T>::OptimizationType::MAX) ? -1 : 1;
+    for (size_t j = 0; j < N; ++j) {
+        obj[DECVARS_INDEX + j] = sign * c[j];
+    }
+
+    // "Big-M method" phase: M on artificial variables, then removed subtracting their rows
+    for (size_t i = 0; i < M; ++i) {
+        if (artificial[2 * i]) {
+            for (size_t col = 0; col < COLUMNS; ++col) {
+                big_M[col] -= tableau[i][col];
+            }
+            big_M[2 * i] = 0;
+        }
+    }
+    // pricing tolerances are relative to the largest value of each objective function row, as in Tableau<T>
+    T cost_scale = 1;
+    T big_M_scale = 1;
+    for (size_t col = 0; col < COLUMNS - 1; ++col) {
+        T cost = obj[col] < 0 ? -obj[col] : obj[col];
+        T big_M_cost = big_M[col] < 0 ? -big_M[col] : big_M[col];
+        cost_scale = cost > cost_scale ? cost : cost_scale;
+        big_M_scale = big_M_cost > big_M_scale ? big_M_cost : big_M_scale;
+    }
+    cost_tolerance = tolerance * cost_scale;
+    big_M_tolerance = tolerance * big_M_scale;
+    clear_big_M_noise();
+    #ifdef PRINT
+    print_tableau();
+    #endif // PRINT
+}
+
+
+/**
+ * @brief method to determine index of base-entering variable column, comparing reduced costs
+ * lexicographically on (M part, real part)
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @return 'int' index of base-entering variable column, -1 if the tableau is optimal
+ */
+template<typename T, size_t M, size_t N>
+int FixedTableau<T, M, N>::find_pivot_column() const {
+
+    int pivot_column = -1;
+    T pivot_big_M = 0;
+    T pivot_value = 0;
+    for (size_t col = 0; col < COLUMNS - 1; ++col) {
+        T big_M = tableau[M + 1][col];
+        T value = tableau[M][col];
+        if (big_M < -big_M_tolerance) {
+            if (big_M < pivot_big_M) {
+                pivot_column = col;
+                pivot_big_M = big_M;
+                pivot_value = value;
+            }
+        } else if (big_M <= big_M_tolerance && pivot_big_M == 0 && value < -cost_tolerance && value < pivot_value) {
+            pivot_column = col;
+            pivot_value = value;
+        }
+    }
+    return pivot_column;
+}
+
+
+/**
+ * @brief method to find index of base exiting variable
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @param pivot_column index of base entering variable
+ * @return 'int' index of base exiting variable row, -1 if the problem is unbounded
+ */
+template<typename T, size_t M, size_t N>
+int FixedTableau<T, M, N>::find_pivot_row(int pivot_column) const {
+
+    int pivot_row = -1;
+    T min_ratio = std::numeric_limits<T>::max();
+    for (size_t row = 0; row < M; ++row) {
+        if (tableau[row][pivot_column] > tolerance) {
+            T ratio = tableau[row][COLUMNS - 1] / tableau[row][pivot_column];
+            if (ratio < min_ratio) {
+                pivot_row = row;
+                min_ratio = ratio;
+            }
+        }
+    }
+    return pivot_row;
+}
+
+
+/**
+ * @brief method for pivot operation
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ * @param pivot_row index of base exiting variable row
+ * @param pivot_column index of base entering variable column
+ */
+template<typename T, size_t M, size_t N>
+void FixedTableau<T, M, N>::pivot(int pivot_row, int pivot_column) {
+
+    base[pivot_row] = pivot_column;
+    T pivot_element = tableau[pivot_row][pivot_column];
+    for (auto& element : tableau[pivot_row]) {
+        element /= pivot_element;
+    }
+    for (size_t row = 0; row < ROWS; ++row) {
+        if (row != static_cast<size_t>(pivot_row)) {
+            T factor = tableau[row][pivot_column];
+            for (size_t col = 0; col < COLUMNS; ++col) {
+                tableau[row][col] -= factor * tableau[pivot_row][col];
+            }
+        }
+    }
+    clear_big_M_noise();
+    #ifdef PRINT
+    print_tableau();
+    #endif // PRINT
+}
+
+
+/**
+ * @brief method to set to 0 the M parts of reduced costs within tolerance, which are rounding noise,
+ * so that it does not build up; as in Tableau<T>, it ends every pivot and add_objFunc_tableau
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ */
+template<typename T, size_t M, size_t N>
+void FixedTableau<T, M, N>::clear_big_M_noise() {
+
+    for (size_t col = 0; col < COLUMNS - 1; ++col) {
+        if (tableau[M + 1][col] >= -big_M_tolerance && tableau[M + 1][col] <= big_M_tolerance) {
+            tableau[M + 1][col] = 0;
+        }
+    }
+}
+
+
+/**
+ * @brief method to check whether the Big-M method left an artificial variable in base with positive value,
+ * i.e. whether the constrain system is infeasible
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ */
+template<typename T, size_t M, size_t N>
+bool FixedTableau<T, M, N>::has_positive_artificial() const {
+
+    for (size_t row = 0; row < M; ++row) {
+        if (base[row] < DECVARS_INDEX && artificial[base[row]] && tableau[row][COLUMNS - 1] > tolerance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef PRINT
+
+/**
+ * @brief method to print the tableau
+ *
+ * @tparam T
+ * @tparam M
+ * @tparam N
+ */
+template<typename T, size_t M, size_t N>
+void FixedTableau<T, M, N>::print_tableau() const {
+
+    std::cout << std::endl;
+    for (const auto& row : tableau) {
+        for (const auto& element : row) {
+            std::cout << element << " ";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
+#endif // PRINT
+
+#endif // __FIXEDTABLEAU_HPP__
@@ -1,7 +1,26 @@
 #ifndef __LINEARCONSTRAINSYSTEM_HPP__
 #define __LINEARCONSTRAINSYSTEM_HPP__
 
+#include <atomic>
+#include <stdexcept>
+
 #include "Tableau.hpp"
+#include "NetworkSimplex.hpp"
+#include "BasisCache.hpp"
+#include "ExactSimplex.hpp"
+
+
+/**
+ * @brief exception thrown when the constrain system has no solution
+ *
+ * It derives from std::runtime_error, the exception thrown for infeasible systems so far, so that
+ * callers catching the latter keep working, while callers catching InfeasibleSystemError can tell
+ * infeasibility apart from other runtime errors, e.g. of the scratch file.
+ */
+struct InfeasibleSystemError : public std::runtime_error {
+    // constructor with the message printed by the examples
+    InfeasibleSystemError() : std::runtime_error("The linear constraint system is INFEASIBLE.") {}
+};
 
 
 /**
@@ -13,8 +32,9 @@ template<typename T>
 struct LinearConstrainSystem {
 
     enum class SolutionType {
-        BOUNDED,  //!< optimal solution found
-        UNBOUNDED //!< the set of solutions is not bounded 
+        BOUNDED,   //!< optimal solution found
+        UNBOUNDED, //!< the set of solutions is not bounded 
+        INFEASIBLE //!< the constrain system has no solution
     };
     enum class ConstrainType {
         EQ, //!< ==
@@ -25,6 +45,15 @@ struct LinearConstrainSystem {
         MIN,  //!< minimize obj function
         MAX   //!< maximize obj function
     };
+    enum class PivotRule {
+        DANTZIG, //!< most negative reduced cost enters the base
+        BLAND,   //!< first improving variable enters the base, ties of the ratio test go to the smallest base variable: never cycles
+        RANDOM   //!< random improving variable enters the base
+    };
+    enum class VariableStatus {
+        BASIC,    //!< variable is in the final base
+        NONBASIC  //!< variable is out of the final base, i.e. equal to 0
+    };
 
     /**
      * @brief struct representing a constrain
@@ -41,6 +70,27 @@ struct LinearConstrainSystem {
         Constrain(const Constrain& orig) : a(orig.a), b(orig.b), type(orig.type) {}
     };
 
+    /**
+     * @brief struct collecting the sensitivity information read from the final tableau
+    */
+    struct SensitivityInfo {
+        std::vector<T> duals;                      //!< dual value (shadow price) dz/db of every constrain
+        std::vector<T> reduced_costs;              //!< reduced cost of every decisional variable
+        std::vector<T> slacks;                     //!< b - a*x for every constrain
+        std::vector<VariableStatus> row_status;    //!< status of the slack, surplus or artificial variable of every constrain
+        std::vector<VariableStatus> column_status; //!< status of every decisional variable
+    };
+
+    /**
+     * @brief struct representing a way of choosing pivots, raced by optimize_concurrent
+    */
+    struct PivotStrategy {
+        PivotRule rule;     //!< rule choosing the base-entering variable
+        unsigned seed;      //!< seed of the random choices of PivotRule::RANDOM
+        // initialization constructor
+        PivotStrategy(PivotRule rule, unsigned seed = 0) : rule(rule), seed(seed) {}
+    };
+
     /**
      * @brief empty constructor
      */
@@ -51,7 +101,58 @@ struct LinearConstrainSystem {
      * 
      * @param orig the LinearConstrainSystem to be copied
     */
-    LinearConstrainSystem(const LinearConstrainSystem& orig) : constrains(orig.constrains), tab(orig.tab) {}
+    LinearConstrainSystem(const LinearConstrainSystem& orig) {
+        *this = orig;
+    }
+
+    /**
+     * @brief move constructor
+     * 
+     * @param orig the LinearConstrainSystem to be moved
+    */
+    LinearConstrainSystem(LinearConstrainSystem&& orig) = default;
+
+    /**
+     * @brief copy assignment: constrains, last tableau and settings are copied, the buffers of the
+     * destination are kept to be reused
+     * 
+     * @param orig the LinearConstrainSystem to be copied
+    */
+    LinearConstrainSystem& operator=(const LinearConstrainSystem& orig) {
+        if (this == &orig) {
+            return *this;
+        }
+        constrains = orig.constrains;
+        tab = orig.tab;
+        feasibility_test = orig.feasibility_test;
+        optimal_tableau = orig.optimal_tableau;
+        objFunc = orig.objFunc;
+        optimization_type = orig.optimization_type;
+        reinversion_interval = orig.reinversion_interval;
+        reinversion_threshold = orig.reinversion_threshold;
+        crash = orig.crash;
+        iterations = orig.iterations;
+        network = orig.network;
+        network_detection = orig.network_detection;
+        network_optimal = orig.network_optimal;
+        basis_cache = orig.basis_cache;
+        exact = orig.exact;
+        exact_verification = orig.exact_verification;
+        exact_pivots = orig.exact_pivots;
+        return *this;
+    }
+
+    /**
+     * @brief move assignment
+     * 
+     * @param orig the LinearConstrainSystem to be moved
+    */
+    LinearConstrainSystem& operator=(LinearConstrainSystem&& orig) = default;
+
+    /**
+     * @brief destructor
+    */
+    ~LinearConstrainSystem() = default;
 
     /**
      * @brief Add constrain a*x type b, e.g., a*x <= b
@@ -63,13 +164,208 @@ struct LinearConstrainSystem {
     inline LinearConstrainSystem& add_constrain(const std::vector<T>& a, const T& b, const ConstrainType type){ 
         // adding constrain to vector of constrains
         constrains.emplace_back(a, b, type);
+        // the feasibility test must consider the new constrain
+        feasibility_test = false;
+        return *this;
+    }
+
+    /**
+     * @brief Replace constrain at position index with a*x type b, reusing its memory
+     * 
+     * Together with the tableau kept by the system between optimizations, this makes the system
+     * a workspace: once a first problem has been solved, loading and solving problems of the
+     * same size does not allocate memory.
+     * 
+     * @param index position of the constrain, in order of insertion
+     * @param a constrain coefficients
+     * @param b known term
+     * @param type constrain type
+     */
+    inline LinearConstrainSystem& set_constrain(size_t index, const std::vector<T>& a, const T& b, const ConstrainType type){ 
+        if (index >= constrains.size()) {
+            throw std::out_of_range("Constrain index out of range");
+        }
+        constrains[index].a.assign(a.begin(), a.end());
+        constrains[index].b = b;
+        constrains[index].type = type;
+        // the feasibility test must consider the new constrain
+        feasibility_test = false;
+        return *this;
+    }
+
+    /**
+     * @brief Keep tableau rows in a memory-mapped scratch file instead of the heap, so that the kernel
+     * can page them out when the tableau is much larger than the constrains
+     *
+     * Tableaus built from now on are written in the file, which grows in chunks of chunk_bytes and
+     * is removed with the system. The last optimal tableau is discarded.
+     *
+     * Only the rows of the tableau, objective function rows included, move to the file. The
+     * constrains, which are dense like the tableau rows, stay on the heap, as do the vector of
+     * row handles and the working buffers of the simplex, whose size grows with the number of
+     * rows or columns only. The system therefore still needs RAM for the constrains. Pivot
+     * updates rows in row order, which is the order of the file, and leaves the paging to the
+     * kernel: it does not stream the file in tiles of its own.
+     *
+     * @param path path of the scratch file
+     * @param chunk_bytes size of the chunks the file is mapped by
+     */
+    inline LinearConstrainSystem& set_scratch_file(const std::string& path, size_t chunk_bytes = 64 << 20){
+        tab.row_allocator = MappedAllocator<T>(std::make_shared<MappedArena>(path, chunk_bytes));
+        // rows on the heap are dropped, the next tableau is built in the file
+        tab.tableau.clear();
+        tab.tableau.shrink_to_fit();
+        optimal_tableau = false;
+        return *this;
+    }
+
+    /**
+     * @brief Set how often the basic solution is checked against the original constrains during
+     * the simplex, and the residual above which the tableau is rebuilt from the current base
+     *
+     * @param interval number of pivots between two checks, 0 to disable them
+     * @param threshold largest residual of a constrain, relative to 1 + |b|
+     */
+    inline LinearConstrainSystem& set_reinversion(size_t interval, const T& threshold){
+        reinversion_interval = interval;
+        reinversion_threshold = threshold;
+        return *this;
+    }
+
+    /**
+     * @brief Set the density of the pivot row above which pivot updates whole rows instead of the
+     * cross product of the nonzero elements of pivot row and pivot column
+     *
+     * @param threshold fraction of nonzero elements in pivot row (default 0.7): 0 always updates
+     * whole rows, 1 always skips zero elements
+     */
+    inline LinearConstrainSystem& set_sparse_pivot_threshold(double threshold){
+        tab.sparse_pivot_threshold = threshold;
+        return *this;
+    }
+
+    /**
+     * @brief Set the number of constrains from which the initial tableau is written by several
+     * threads, each one writing a contiguous block of rows
+     *
+     * @param threshold number of constrains (default 20000): 0 always writes rows with several
+     * threads, std::numeric_limits<size_t>::max() never
+     */
+    inline LinearConstrainSystem& set_parallel_rows_threshold(size_t threshold){
+        tab.parallel_rows_threshold = threshold;
+        return *this;
+    }
+
+    /**
+     * @brief Enable or disable the crash of the starting base, which moves decisional variables into
+     * it in place of artificial variables before the simplex starts
+     *
+     * Pivots of the crash are counted by get_iterations. The crash changes the path of the simplex,
+     * hence the optimal base found when the optimum is not unique.
+     *
+     * @param enabled true to crash the starting base (default false)
+     */
+    inline LinearConstrainSystem& set_crash(bool enabled){
+        crash = enabled;
+        return *this;
+    }
+
+    /**
+     * @brief Set the rule choosing the base-entering variable
+     *
+     * @param rule pivot rule (default PivotRule::DANTZIG)
+     * @param seed seed of the random choices of PivotRule::RANDOM
+     */
+    inline LinearConstrainSystem& set_pivot_rule(PivotRule rule, unsigned seed = 0){
+        tab.pivot_rule = rule;
+        tab.random_engine.seed(seed);
+        return *this;
+    }
+
+    /**
+     * @brief Enable or disable the detection of network structure, e.g. transportation and assignment
+     * problems, which are then solved by the network simplex instead of the tableau
+     *
+     * Post-optimal methods are available after the network simplex as well: dual values are read
+     * from node potentials, the other methods first build the optimal tableau from the spanning
+     * tree, at the cost of one reinversion.
+     *
+     * @param enabled true to detect network structure (default false)
+     */
+    inline LinearConstrainSystem& set_network_detection(bool enabled){
+        network_detection = enabled;
+        return *this;
+    }
+
+    /**
+     * @brief Start optimizations from the optimal base cached for systems of the same structure, and
+     * cache the optimal base they find
+     *
+     * Systems resubmitted with the same dimensions, constrain types and nonzero pattern, but
+     * slightly different coefficients, start close to their optimum: the cached base skips the
+     * feasibility test and most pivots. A base that is singular or infeasible for the new
+     * coefficients is dropped and the optimization starts from the slack/artificial base.
+     * Systems with network structure are solved by the network simplex and do not use the cache.
+     *
+     * @param cache cache of optimal bases, e.g. BasisCache<T>::global(); nullptr to disable it (default)
+     */
+    inline LinearConstrainSystem& set_basis_cache(std::shared_ptr<BasisCache<T>> cache){
+        basis_cache = std::move(cache);
         return *this;
     }
 
+    /**
+     * @brief Enable or disable the verification of every optimization in exact rational arithmetic
+     *
+     * optimize(solution, c, type) and optimize_concurrent then run verify_exact after the
+     * floating-point simplex: its status is the exact one, the solution is the exact one rounded
+     * to T, and a system declared infeasible only by rounding errors is solved anyway. The tableau
+     * is rebuilt from the exact optimal base, so that post-optimal analysis refers to it.
+     *
+     * @param enabled true to verify optimizations (default false)
+     */
+    inline LinearConstrainSystem& set_exact_verification(bool enabled){
+        exact_verification = enabled;
+        return *this;
+    }
+
+    /**
+     * @brief Get the number of pivots performed by the last feasibility test or optimization,
+     * crash of the starting base included
+     */
+    inline size_t get_iterations() const { return iterations; }
+
+    /**
+     * @brief Get the number of exact pivots performed by the last verify_exact to certify or repair
+     * the floating-point base, 0 if it was already optimal
+     */
+    inline size_t get_exact_pivots() const { return exact_pivots; }
+
     // method to check if the system is feasible
     bool is_feasible();
     // method to optimize c*x with respect to the constrain system with x 
     SolutionType optimize(std::vector<T>& solution, const std::vector<T>& c, const OptimizationType type);
+    // method to optimize c*x racing several pivot strategies on separate threads
+    SolutionType optimize_concurrent(std::vector<T>& solution, const std::vector<T>& c, const OptimizationType type,
+                                     const std::vector<PivotStrategy>& strategies);
+    // method to optimize c*x and also collect dual values, reduced costs, slacks and base status
+    SolutionType optimize(std::vector<T>& solution, const std::vector<T>& c, const OptimizationType type, SensitivityInfo& info);
+    // method to compute the interval of every objective function coefficient keeping the last optimal base optimal
+    void cost_ranging(std::vector<std::pair<T, T>>& ranges) const;
+    // method to compute the interval of every constant term keeping the last optimal base optimal
+    void rhs_ranging(std::vector<std::pair<T, T>>& ranges) const;
+    // method to follow the optimal value while constant terms move along a direction
+    SolutionType parametric_rhs(const std::vector<T>& direction, const T& t_max, std::vector<std::pair<T, T>>& breakpoints) const;
+    // method to follow the optimal value while objective function coefficients move along a direction
+    SolutionType parametric_cost(const std::vector<T>& direction, const T& t_max, std::vector<std::pair<T, T>>& breakpoints) const;
+    // method to get the dual value of every constrain from the last optimal tableau
+    void get_duals(std::vector<T>& duals) const;
+    // method to verify and repair the last base in exact rational arithmetic
+    SolutionType verify_exact(std::vector<Rational>& solution, std::vector<Rational>& duals, const std::vector<T>& c,
+                              const OptimizationType type);
+    // method to add a decisional variable to a solved system and continue the optimization
+    SolutionType add_variable(std::vector<T>& solution, const std::vector<T>& column, const T& cost,
+                              const T& upper_bound = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max());
     // method to print obtained results
     void print_result(SolutionType type, std::vector<T>& solution) const;
     // method to print the optimization problem given as input
@@ -78,13 +374,58 @@ struct LinearConstrainSystem {
   private:
 
     std::vector<Constrain> constrains; //!< vector containing objects of type Constrain
-    Tableau<T> tab;                    //!< object of the struct Tableau
+    mutable Tableau<T> tab;            //!< object of the struct Tableau, built from the network simplex when post-optimal analysis needs it
     bool feasibility_test{false};      //!< flag to keep track whether the user has already executed the is_feasible method for a constrain system
+    mutable bool optimal_tableau{false}; //!< flag to keep track whether tab holds the optimal tableau of the last optimization
+    std::vector<T> objFunc;            //!< objective function coefficients of the last optimization
+    OptimizationType optimization_type{OptimizationType::MAX}; //!< optimization type of the last optimization
+    std::vector<size_t> base_position; //!< buffer reused by read_sensitivity for the base row of every column
+    size_t reinversion_interval{100};  //!< number of pivots between two checks of the basic solution, 0 to disable them
+    T reinversion_threshold = std::numeric_limits<T>::epsilon() * (1 << 20); //!< residual above which the tableau is rebuilt from its base
+    bool crash{false};                 //!< flag to crash the starting base before the simplex
+    size_t iterations{0};              //!< number of pivots performed by the last feasibility test or optimization
+    NetworkSimplex<T> network;         //!< object of the class NetworkSimplex, for systems with network structure
+    bool network_detection{false};     //!< flag to solve systems with network structure by the network simplex
+    mutable bool network_optimal{false}; //!< flag to keep track whether network holds the optimal spanning tree of the last optimization
+    const std::atomic<bool>* cancel_flag{nullptr}; //!< flag set when another strategy of optimize_concurrent has finished, null if not racing
+    std::shared_ptr<BasisCache<T>> basis_cache; //!< cache of optimal bases shared with systems of the same structure, null if disabled
+    std::vector<size_t> basis_variables; //!< buffer for the variables of a base read from or written to basis_cache
+    ExactSimplex<T> exact;             //!< object of the class ExactSimplex, for the verification in exact arithmetic
+    bool exact_verification{false};    //!< flag to verify optimizations in exact arithmetic
+    size_t exact_pivots{0};            //!< number of pivots performed by the last verification in exact arithmetic
+    std::vector<Rational> exact_solution; //!< buffer for the exact solution of a verified optimization
+    std::vector<Rational> exact_duals; //!< buffer for the exact dual values of a verified optimization
     
     // method to update useful information about Tableau construction
     void update_tableau_info();
     // method to check if input constrain are valid
     void check_valid_constrains() const;
+    // method to execute pivot method until it gets interrupted
+    SolutionType run_pivots();
+    // method to run the network simplex on a system with network structure
+    SolutionType run_network(const std::vector<T>& c, const OptimizationType type);
+    // method to run the simplex algorithm on the tableau
+    SolutionType run_simplex(const std::vector<T>& c, const OptimizationType type);
+    // method to optimize c*x with the simplex, the network simplex or exact verification, as enabled
+    SolutionType run_optimization(std::vector<T>& solution, const std::vector<T>& c, const OptimizationType type, SensitivityInfo* info);
+    // method to read the solution from the final tableau
+    void read_final_tableau(std::vector<T>& solution, const OptimizationType type);
+    // method to read sensitivity information from the final tableau
+    void read_sensitivity(const OptimizationType type, SensitivityInfo& info);
+    // method to check that an optimal tableau is available for post-optimal analysis
+    void check_optimal_tableau() const;
+    // method to build the optimal tableau from the spanning tree of the network simplex
+    void restore_tableau() const;
+    // method to get the variable of a tableau column, independent of the tableau layout
+    size_t get_basis_variable(size_t column) const;
+    // method to build the tableau of the base in basis_variables
+    bool load_base(const std::vector<T>& c, const OptimizationType type);
+    // method to build the tableau of the base found in basis_cache
+    bool warm_start(const std::vector<T>& c, const OptimizationType type);
+    // method to run the floating-point simplex and verify its result in exact arithmetic
+    SolutionType run_verified(std::vector<T>& solution, const std::vector<T>& c, const OptimizationType type);
+    // method to verify in exact arithmetic the base left by the floating-point simplex
+    SolutionType read_verified(std::vector<T>& solution, const std::vector<T>& c, const OptimizationType type);
 
     /**
      * @brief method to check if input objective function is valid
@@ -110,12 +451,21 @@ struct LinearConstrainSystem {
 template<typename T>
 void LinearConstrainSystem<T>::update_tableau_info() {
 
+    // resetting counters in case the method has already been called
+    tab.slack_variables = 0;
+    tab.surplus_variables = 0;
+    tab.artificial_variables = 0;
     // updating number of constrains in tableau
     tab.num_constrains = constrains.size();
     // updating number of decisional variables in tableau
     tab.num_variables = constrains[0].a.size(); 
     // updating number of added variables in tableau (i.e. slack, surplus, artificial)
-    for (const auto& constrain : constrains) {
+    // and, as their prefix sum, the column of the first added variable of every row
+    tab.additional_var_offsets.resize(constrains.size());
+    size_t offset = 0;
+    for (size_t i = 0; i < constrains.size(); ++i) {
+        const Constrain& constrain = constrains[i];
+        tab.additional_var_offsets[i] = offset;
         
         switch (constrain.type) {
             case ConstrainType::LE:
@@ -123,8 +473,10 @@ void LinearConstrainSystem<T>::update_tableau_info() {
                 if (constrain.b < 0){
                     tab.surplus_variables++;
                     tab.artificial_variables++;
+                    offset += 2;
                 } else {
                     tab.slack_variables++;
+                    offset += 1;
                 }
 
                 break;
@@ -132,14 +484,17 @@ void LinearConstrainSystem<T>::update_tableau_info() {
 
                 if (constrain.b < 0){
                     tab.slack_variables++;
+                    offset += 1;
                 } else {
                 tab.surplus_variables++;
                 tab.artificial_variables++;                    
+                offset += 2;
                 }
                 break;
             case ConstrainType::EQ:
 
                 tab.artificial_variables++;
+                offset += 1;
                 break;
         }
     }
@@ -167,6 +522,9 @@ void LinearConstrainSystem<T>::check_valid_constrains() const {
 /**
  * @brief method to establish if the constrain system is feasible
  * 
+ * The Big-M method is executed with a null objective function: the constant term of the M row
+ * is -(sum of the artificial variables left in base), so the system is infeasible if it is < 0.
+ * 
  * @tparam T
  * @return true if the system is feasible
  * @return false if the system is infeasible
@@ -178,57 +536,37 @@ bool LinearConstrainSystem<T>::is_feasible() {
     check_valid_constrains();
     // updating input information received so far
     update_tableau_info();
-    // creating a copy of the linear constrain system received so far
-    LinearConstrainSystem<T> copy(*this);
-
-    // updating dimension of constrains inserted so far to make place for the dummy variable
-    for (size_t i=0; i< copy.constrains.size(); ++i) { 
-        copy.constrains[i].a.push_back(0);
-    }
-    // creating constrain coefficients referring to dummy variable
-    std::vector<T> a_dummy(copy.constrains[0].a.size()-1, 0);
-    a_dummy.emplace_back(1);
-    // adding constrain to constrain system
-    copy.add_constrain(a_dummy, 0 ,ConstrainType::EQ);
-    // updating dummy variable information inside tableau
-    copy.tab.num_constrains++;
-    copy.tab.num_variables++;
-    copy.tab.artificial_variables++;
+    // the tableau built here is not the optimal one of an optimization
+    optimal_tableau = false;
+    network_optimal = false;
+    // null objective function, stored in the buffer of the last objective function to avoid allocations
+    objFunc.assign(tab.num_variables, 0);
+    // systems with network structure are tested without building the tableau
+    if (network_detection && network.load(constrains)) {
+        run_network(objFunc, LinearConstrainSystem<T>::OptimizationType::MAX);
+        return true;
+    }
     // creating initial tableau
-    copy.tab.create_initial_tableau(copy.constrains);
-    // creating dummy objective variable
-    std::vector<T> c(copy.tab.num_variables - 1, 0);
-    c.emplace_back(1);
-    // adding dummy objective variable to tableau
-    copy.tab.add_objFunc_tableau(c, LinearConstrainSystem<T>::OptimizationType::MAX);
+    tab.create_initial_tableau(constrains);
+    // sum of the initial values of artificial variables, to scale the tolerance of the test
+    T scale = 1;
+    for (const auto& indeces : tab.artificial_var_indices) {
+        scale += tab.tableau[indeces.first].back();
+    }
+    iterations = crash ? tab.crash_basis() : 0;
+    // adding null objective function to tableau
+    tab.add_objFunc_tableau(objFunc, LinearConstrainSystem<T>::OptimizationType::MAX);
 
     // executing symplex pivot method until it gets interrupted
-    bool hasSimplexFinished = false;
-    while (!hasSimplexFinished ) {
-        // obtaining index of base-entering variable
-        int pivot_column = copy.tab.find_pivot_column();
-        // if the index is -1 then there are not variables to enter the base anymore: the loop interrupts
-        if (pivot_column == -1 ) {    
-            #ifdef PRINT        
-            std::cout << "----End Simplex----" << std::endl<<std::endl;
-            #endif // PRINT
-            hasSimplexFinished = true; 
-        }
-        if (hasSimplexFinished == false) {
-            // obtaining index of base-exiting variable
-            int pivot_row = copy.tab.find_pivot_row(pivot_column);
-            // pivot executes
-            copy.tab.pivot(pivot_row, pivot_column);
-        }
-    }
+    run_pivots();
     #ifdef PRINT 
     std::cout<< "FEASIBILITY TEST: "<< std::endl<<std::endl;  
     #endif // PRINT
 
-    T solution = copy.tab.tableau[copy.tab.num_constrains].back();
-    // if z<0 then the system is infeasible
-    if (solution < 0) {
-        throw std::runtime_error("The linear constraint system is INFEASIBLE.");
+    T solution = tab.tableau[tab.num_constrains + 1].back();
+    // if artificial variables are still positive then the system is infeasible
+    if (solution < -tab.tolerance * scale) {
+        throw InfeasibleSystemError();
         return false;
     // otherwise it is feasible
     } else {
@@ -242,6 +580,50 @@ bool LinearConstrainSystem<T>::is_feasible() {
 }
 
 
+/**
+ * @brief method to execute pivot method on tableau until no variable can enter the base
+ * 
+ * @tparam T
+ * @return BOUNDED if the tableau is optimal, UNBOUNDED if the entering variable can grow without limit
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::run_pivots() {
+
+    // number of pivots performed so far
+    size_t pivots = 0;
+    // executing pivot method until it gets interrupted
+    while (true) {
+        // another strategy of optimize_concurrent has already finished: the result is discarded
+        if (cancel_flag != nullptr && cancel_flag->load(std::memory_order_relaxed)) {
+            return SolutionType::BOUNDED;
+        }
+        // obtaining base-entering variable index
+        int pivot_column = tab.find_pivot_column();
+        // if pivot column is -1 then there are no variable that can be set in base anymore; symplex is interrupted
+        if (pivot_column == -1) {
+            #ifdef PRINT
+            std::cout << "----End Simplex----" << std::endl<<std::endl;
+            #endif // PRINT
+            return SolutionType::BOUNDED;
+        }
+        // obtaining base-exiting variable index
+        int pivot_row = tab.find_pivot_row(pivot_column);
+        // if pivot row is -1 then the system is unbounded
+        if (pivot_row == -1) {
+            return SolutionType::UNBOUNDED;
+        }
+        // performing pivot method
+        tab.pivot(pivot_row, pivot_column);
+        iterations++;
+        // rounding errors drift the tableau away from the original constrains: it is periodically checked
+        // and rebuilt from the current base when the residual grows too large
+        if (reinversion_interval != 0 && ++pivots % reinversion_interval == 0 && tab.get_residual(constrains) > reinversion_threshold) {
+            tab.reinvert(constrains, objFunc, optimization_type);
+        }
+    }
+}
+
+
 /**
  * @brief method to optimize c*x executing pivot method on tableau
  * 
@@ -256,69 +638,60 @@ typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::optimi
                                                                                    const  std::vector<T>& c, 
                                                                                    const OptimizationType type) {
 
-    // variable that will be returned
-    LinearConstrainSystem<T>::SolutionType sol_type; 
-    // if user has not executed is_feasible then do it
-    if (feasibility_test == false) {
-        is_feasible();
-    }
-    // checking input objective function
-    check_valid_objFunc(c, type);
-    // creating a copy of the LinearConstrainSystem obtained so far
-    LinearConstrainSystem<T> copy(*this);
-    // creating initial tableau
-    copy.tab.create_initial_tableau(copy.constrains);
-    // adding objective function row to tableau
-    copy.tab.add_objFunc_tableau(c, type);
-
-    // SIMPLEX ALGORITHM PROCEDURE:
-    // Executing pivot method until it gets interrupted
-    bool hasSimplexFinished = false;
-    while (!hasSimplexFinished) {
+    return run_optimization(solution, c, type, nullptr);
+}
 
-        // obtaining base-entering variable index
-        int pivot_column = copy.tab.find_pivot_column();
-        // if pivot column is -1 then there are no variable that can be set in base anymore; symplex is interrupted
-        if (pivot_column == -1 ) {            
-            #ifdef PRINT
-            std::cout << "----End Simplex----" << std::endl<<std::endl;
-            #endif // PRINT
-            hasSimplexFinished = true; 
-        }
-        if (hasSimplexFinished == false) {
-            // obtaining base-exiting variable index
-            int pivot_row = copy.tab.find_pivot_row(pivot_column);
-            // if pivot row is -1 then the system is unbounded
-            if (pivot_row == -1) {
-                sol_type = SolutionType::UNBOUNDED; // update and then return the variable
-                print_Lcs(c,type);
-                print_result(sol_type, solution);  
-                return sol_type;   
-            }
-            // performing pivot method
-            copy.tab.pivot(pivot_row, pivot_column);
-        }
-    }
-    // writing found solution
-    solution.resize(copy.tab.num_variables); 
 
-    for (size_t i = 0; i < copy.tab.num_variables; ++i) {
-        // getting indexes of decisional variables
-        size_t decision_variable = copy.tab.get_decVars_index() + i;
-        // searching base vector for indexes of decisional variables
-        auto index = std::find(copy.tab.base.begin(), copy.tab.base.end(), decision_variable); 
+/**
+ * @brief method to optimize c*x with the network simplex if the system has network structure,
+ * with the simplex otherwise, verifying the result in exact arithmetic if enabled
+ * 
+ * Sensitivity information is read from the optimal tableau: after the network simplex it is built
+ * from the spanning tree, after exact verification it follows the exact optimal base.
+ * 
+ * @tparam T
+ * @param solution vector containing solution
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @param info pointer to the sensitivity information to fill, nullptr if not requested
+ * @return LinearConstrainSystem<T>::SolutionType 
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::run_optimization(std::vector<T>& solution,
+                                                                                           const std::vector<T>& c,
+                                                                                           const OptimizationType type,
+                                                                                           SensitivityInfo* info) {
 
-        if (index != copy.tab.base.end()) {
-            // tableau row index corresponding to base variable found
-            size_t row = index - copy.tab.base.begin();
-            // taking last value of the row (i.e. the constant term) and saving it in solution
-            solution[i] = copy.tab.tableau[row].back();
+    SolutionType sol_type;
+    // systems with network structure are solved without building the tableau
+    check_valid_constrains();
+    if (exact_verification) {
+        sol_type = run_verified(solution, c, type);
+    } else if (network_detection && network.load(constrains)) {
+        update_tableau_info();
+        check_valid_objFunc(c, type);
+        // saving objective function for post-optimal analysis
+        objFunc = c;
+        optimization_type = type;
+        sol_type = run_network(c, type);
+        if (sol_type == SolutionType::BOUNDED) {
+            network.get_solution(solution, c);
+            network_optimal = true;
+        }
+    } else {
+        sol_type = run_simplex(c, type);
+        if (sol_type == SolutionType::BOUNDED) {
+            // writing found solution
+            read_final_tableau(solution, type);
         }
     }
-    // saving z value at the end of solution vector
-    solution.emplace_back(copy.tab.tableau[copy.tab.num_constrains].back());
+    if (info != nullptr && sol_type == SolutionType::BOUNDED) {
+        // the solution of the network simplex or of the exact verification is kept, only the
+        // sensitivity information is read from the tableau
+        check_optimal_tableau();
+        read_sensitivity(type, *info);
+    }
     // printing optimization problem
-    sol_type = SolutionType::BOUNDED;     
     print_Lcs(c,type);
     print_result(sol_type, solution);  
 
@@ -327,79 +700,1117 @@ typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::optimi
 
 
 /**
- * @brief  method to print input optimization problem
+ * @brief method to optimize c*x racing several pivot strategies, each on a copy of the system
+ * running on its own thread
  * 
- * @tparam T 
- * @param c coefficients of objective function vector
+ * Copies get the constrains and the settings of the system only, not its last tableau, and build
+ * their own. The first copy to finish, feasibility test included, gives the result and its tableau
+ * is kept by the system, as if optimize had been executed with its strategy; the other copies stop
+ * at their next pivot. Errors are forwarded from the winning copy only. With exact verification
+ * enabled, the result of the winning copy is verified as optimize does. Systems with network
+ * structure are solved by optimize, since the network simplex does not use pivot rules.
+ * 
+ * @tparam T
+ * @param solution vector containing solution
+ * @param c vector containing objective function coefficients
  * @param type optimization type
+ * @param strategies pivot strategies to race, one thread each
+ * @return LinearConstrainSystem<T>::SolutionType 
  */
 template<typename T>
-void LinearConstrainSystem<T>::print_Lcs(const std::vector<T>& c, const OptimizationType type) const {
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::optimize_concurrent(std::vector<T>& solution,
+                                                                                              const std::vector<T>& c,
+                                                                                              const OptimizationType type,
+                                                                                              const std::vector<PivotStrategy>& strategies) {
 
-    std::cout<< "Optimization problem: "<< std::endl<< std::endl;
-    std::cout << (type == OptimizationType::MIN ? "Minimize: " : "Maximize: ") << c[0] << "x1";
-    for (size_t i = 1; i < c.size(); ++i) {
-        if (c[i] >= 0) {
-            std::cout << " + " << c[i] << "x" << (i + 1);
-        } else {
-            std::cout << " - " << -c[i] << "x" << (i + 1);
-        }
+    if (strategies.empty()) {
+        throw std::invalid_argument("At least one pivot strategy is required");
+    }
+    check_valid_constrains();
+    if (network_detection && network.load(constrains)) {
+        return optimize(solution, c, type);
     }
-    std::cout << std::endl << "Subject to:" << std::endl;
 
-    for (const auto &constrain : constrains) {
-        std::cout << constrain.a[0]<< "x1";
-        for (size_t i = 1; i < constrain.a.size(); ++i) {
-            if (constrain.a[i] >= 0) {
-                std::cout << " + " << constrain.a[i] << "x" << (i + 1);
-            } else {
-                std::cout << " - " << -constrain.a[i] << "x" << (i + 1);
+    std::vector<LinearConstrainSystem> racers(strategies.size());
+    std::atomic<bool> finished{false};
+    size_t winner = 0;
+    SolutionType sol_type = SolutionType::BOUNDED;
+    std::exception_ptr error;
+    std::vector<std::thread> threads;
+    for (size_t k = 0; k < strategies.size(); ++k) {
+        LinearConstrainSystem& racer = racers[k];
+        racer.constrains = constrains;
+        racer.feasibility_test = feasibility_test;
+        racer.reinversion_interval = reinversion_interval;
+        racer.reinversion_threshold = reinversion_threshold;
+        racer.crash = crash;
+        racer.basis_cache = basis_cache;
+        racer.tab.tolerance = tab.tolerance;
+        racer.tab.parallel_rows_threshold = tab.parallel_rows_threshold;
+        racer.tab.sparse_pivot_threshold = tab.sparse_pivot_threshold;
+        racer.tab.parallel_scan_threshold = tab.parallel_scan_threshold;
+        // tableau rows go to the scratch file of the system, if any
+        racer.tab.row_allocator = tab.row_allocator;
+        racer.set_pivot_rule(strategies[k].rule, strategies[k].seed);
+        racer.cancel_flag = &finished;
+        threads.emplace_back([&racers, &finished, &winner, &sol_type, &error, &c, type, k]() {
+            SolutionType racer_type = SolutionType::BOUNDED;
+            std::exception_ptr racer_error;
+            try {
+                racer_type = racers[k].run_simplex(c, type);
+            } catch (...) {
+                racer_error = std::current_exception();
             }
-        }
+            // the first copy to finish cancels the others
+            if (!finished.exchange(true)) {
+                winner = k;
+                sol_type = racer_type;
+                error = racer_error;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
 
-        switch (constrain.type) {
-            case ConstrainType::LE:
-                std::cout << " <= ";
-                break;
-            case ConstrainType::GE:
-                std::cout << " >= ";
-                break;
-            case ConstrainType::EQ:
-                std::cout << " = ";
-                break;
+    // keeping the state of the winning copy, with the pivot rule of this system
+    PivotRule rule = tab.pivot_rule;
+    std::minstd_rand random_engine = tab.random_engine;
+    tab = std::move(racers[winner].tab);
+    tab.pivot_rule = rule;
+    tab.random_engine = random_engine;
+    feasibility_test = racers[winner].feasibility_test;
+    optimal_tableau = racers[winner].optimal_tableau;
+    network_optimal = false;
+    objFunc = racers[winner].objFunc;
+    optimization_type = racers[winner].optimization_type;
+    iterations = racers[winner].iterations;
+    if (exact_verification) {
+        // infeasibility is decided by the exact verification
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const InfeasibleSystemError&) {
+            }
+        }
+        sol_type = read_verified(solution, c, type);
+    } else {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if (sol_type == SolutionType::BOUNDED) {
+            // writing found solution
+            read_final_tableau(solution, type);
         }
-        std::cout << constrain.b << std::endl;
     }
+    // printing optimization problem
+    print_Lcs(c,type);
+    print_result(sol_type, solution);  
 
+    return sol_type;
 }
 
+
 /**
- * @brief method to print optimal solution found for the optimization problem
+ * @brief method to optimize c*x also collecting sensitivity information from the final tableau
+ * 
+ * The optimization is the one of optimize, network simplex and exact verification included.
  * 
  * @tparam T
- * @param type optimization type
  * @param solution vector containing solution
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @param info dual values, reduced costs, slacks and base status; left untouched if the problem is unbounded
+ * @return LinearConstrainSystem<T>::SolutionType 
  */
-template<typename T>  
-void LinearConstrainSystem<T>::print_result(SolutionType type, std::vector<T>& solution) const {
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::optimize(std::vector<T>& solution,
+                                                                                   const  std::vector<T>& c, 
+                                                                                   const OptimizationType type,
+                                                                                   SensitivityInfo& info) {
 
-    // BOUNDED case
-    if (type == LinearConstrainSystem<T>::SolutionType::BOUNDED) {
-        
-        std::cout << std::endl;  
-        std::cout << "Bounded solution found:" << std::endl;
+    return run_optimization(solution, c, type, &info);
+}
 
-        for (size_t i = 0; i < solution.size()-1; i++) {
-            
-            std::cout << "x" << i + 1 << " = " << solution[i] << std::endl;           
-        }
-        std::cout << std::endl; 
 
-        std::cout<< "Optimal value z= "<< solution.back() << std::endl<< std::endl;
+/**
+ * @brief method to optimize c*x with the network simplex, on a system loaded by NetworkSimplex::load
+ * 
+ * The network simplex also decides feasibility, which is reported as is_feasible does. No tableau
+ * is built: post-optimal methods build it from the spanning tree when they need it.
+ * 
+ * @tparam T
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @return LinearConstrainSystem<T>::SolutionType 
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::run_network(const std::vector<T>& c, 
+                                                                                      const OptimizationType type) {
 
-    // UNBOUNDED case
-    } else {
-        std::cout << "UNBOUNDED SOLUTION" << std::endl<< std::endl;
+    optimal_tableau = false;
+    network_optimal = false;
+    #ifdef PRINT
+    std::cout << "Network structure detected: solving with the network simplex" << std::endl << std::endl;
+    #endif // PRINT
+    SolutionType sol_type = network.solve(c, type, iterations);
+    if (sol_type == SolutionType::INFEASIBLE) {
+        throw InfeasibleSystemError();
+    }
+    feasibility_test = true;
+    return sol_type;
+}
+
+
+/**
+ * @brief method to build the tableau for c*x and execute the pivot method on it until it stops
+ * 
+ * @tparam T
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @return LinearConstrainSystem<T>::SolutionType 
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::run_simplex(const std::vector<T>& c, 
+                                                                                      const OptimizationType type) {
+
+    // a feasible base cached for the same structure replaces the feasibility test and the starting base
+    uint64_t fingerprint = 0;
+    bool warm = false;
+    if (basis_cache) {
+        check_valid_constrains();
+        fingerprint = BasisCache<T>::fingerprint(constrains);
+        if (basis_cache->find(fingerprint, basis_variables)) {
+            update_tableau_info();
+            check_valid_objFunc(c, type);
+            warm = warm_start(c, type);
+        }
+    }
+    if (!warm) {
+        // if user has not executed is_feasible then do it
+        if (feasibility_test == false) {
+            is_feasible();
+        }
+        // checking input objective function
+        check_valid_objFunc(c, type);
+    }
+    // saving objective function for post-optimal analysis
+    objFunc = c;
+    optimization_type = type;
+    optimal_tableau = false;
+    network_optimal = false;
+    if (warm) {
+        feasibility_test = true;
+        iterations = 0;
+    } else {
+        // creating initial tableau; it is kept after the optimization to read the final state from it
+        tab.create_initial_tableau(constrains);
+        iterations = crash ? tab.crash_basis() : 0;
+        // adding objective function row to tableau
+        tab.add_objFunc_tableau(c, type);
+    }
+
+    // SIMPLEX ALGORITHM PROCEDURE:
+    // Executing pivot method until it gets interrupted
+    if (run_pivots() == SolutionType::UNBOUNDED) {
+        return SolutionType::UNBOUNDED;
+    }
+    optimal_tableau = true;
+    // caching the optimal base, unless the simplex has been stopped by another strategy of optimize_concurrent
+    if (basis_cache && (cancel_flag == nullptr || !cancel_flag->load())) {
+        basis_variables.resize(tab.num_constrains);
+        for (size_t row = 0; row < tab.num_constrains; ++row) {
+            basis_variables[row] = get_basis_variable(tab.base[row]);
+        }
+        basis_cache->store(fingerprint, basis_variables);
+    }
+    return SolutionType::BOUNDED;
+}
+
+
+/**
+ * @brief method to read the solution from the final tableau
+ * 
+ * @tparam T
+ * @param solution vector where decisional variables and z are written
+ * @param type optimization type
+ */
+template<typename T>
+void LinearConstrainSystem<T>::read_final_tableau(std::vector<T>& solution, const OptimizationType type) {
+
+    // index of objective function row
+    size_t ObjFunc_row = tab.num_constrains;
+    // index of the first decisional variable column
+    size_t decVars_index = tab.get_decVars_index();
+    // the tableau always minimizes: results of a maximization have opposite sign
+    T sign = (type == OptimizationType::MAX) ? -1 : 1;
+
+    // writing decisional variables in base, all the others are 0
+    solution.assign(tab.num_variables, 0);
+    for (size_t row = 0; row < tab.num_constrains; ++row) {
+        if (tab.base[row] >= decVars_index) {
+            // taking last value of the row (i.e. the constant term) and saving it in solution
+            solution[tab.base[row] - decVars_index] = tab.tableau[row].back();
+        }
+    }
+    // saving z value at the end of solution vector: the constant term of objective function row is -z of the minimization
+    solution.emplace_back(-sign * tab.tableau[ObjFunc_row].back());
+}
+
+
+/**
+ * @brief method to read dual values, reduced costs, slacks and base status from the final tableau
+ * 
+ * Every quantity is read with a single pass over the base and the objective function row:
+ * the columns of the starting slack/artificial base hold the inverse base matrix (see get_duals).
+ * 
+ * @tparam T
+ * @param type optimization type
+ * @param info sensitivity information to fill
+ */
+template<typename T>
+void LinearConstrainSystem<T>::read_sensitivity(const OptimizationType type, SensitivityInfo& info) {
+
+    // index of objective function row
+    size_t ObjFunc_row = tab.num_constrains;
+    // index of the first decisional variable column
+    size_t decVars_index = tab.get_decVars_index();
+    // the tableau always minimizes: results of a maximization have opposite sign
+    T sign = (type == OptimizationType::MAX) ? -1 : 1;
+
+    // position of every column inside the base, tab.num_constrains if not in base
+    std::vector<size_t>& base_row = base_position;
+    base_row.assign(tab.get_total_columns() - 1, tab.num_constrains);
+    for (size_t row = 0; row < tab.num_constrains; ++row) {
+        base_row[tab.base[row]] = row;
+    }
+
+    get_duals(info.duals);
+    info.slacks.resize(tab.num_constrains);
+    info.row_status.resize(tab.num_constrains);
+    for (size_t i = 0; i < tab.num_constrains; ++i) {
+        const Constrain& constrain = constrains[i];
+        // rows with negative constant term have been multiplied by -1 inside tableau
+        T row_sign = (constrain.b < 0) ? -1 : 1;
+        // type of the constrain as it has been written inside tableau
+        bool is_LE = (constrain.type == ConstrainType::LE) == (constrain.b >= 0) && constrain.type != ConstrainType::EQ;
+        bool is_GE = constrain.type != ConstrainType::EQ && !is_LE;
+        // column of the slack (LE) or artificial (GE, EQ) variable put in base for this row
+        size_t identity_column = tab.additional_var_offsets[i];
+
+        // column of the variable measuring how far the constrain is from being active (artificial for EQ)
+        size_t logical_column = is_GE ? identity_column + 1 : identity_column;
+        bool is_basic = base_row[logical_column] != tab.num_constrains;
+        T value = is_basic ? tab.tableau[base_row[logical_column]].back() : 0;
+        if (constrain.type == ConstrainType::EQ) {
+            info.slacks[i] = 0;
+        } else {
+            info.slacks[i] = row_sign * (is_LE ? value : -value);
+        }
+        info.row_status[i] = is_basic ? VariableStatus::BASIC : VariableStatus::NONBASIC;
+    }
+
+    info.reduced_costs.resize(tab.num_variables);
+    info.column_status.resize(tab.num_variables);
+    for (size_t j = 0; j < tab.num_variables; ++j) {
+        info.reduced_costs[j] = sign * tab.tableau[ObjFunc_row][decVars_index + j];
+        info.column_status[j] = (base_row[decVars_index + j] != tab.num_constrains) ? VariableStatus::BASIC : VariableStatus::NONBASIC;
+    }
+}
+
+
+/**
+ * @brief method to get the dual value (shadow price) dz/db of every constrain from the last optimal tableau
+ * 
+ * The columns of the starting slack/artificial base hold the inverse base matrix and their real
+ * cost is 0, so the dual value of a constrain is the opposite of the objective function coefficient
+ * of its column. These are the prices of column generation subproblems. After the network
+ * simplex they are read from node potentials instead.
+ * 
+ * @tparam T
+ * @param duals vector where dual values are written
+ */
+template<typename T>
+void LinearConstrainSystem<T>::get_duals(std::vector<T>& duals) const {
+
+    if (network_optimal) {
+        network.get_duals(duals, optimization_type);
+        return;
+    }
+    // the tableau of an unbounded or network optimization is not available
+    check_optimal_tableau();
+
+    // the tableau always minimizes: results of a maximization have opposite sign
+    T sign = (optimization_type == OptimizationType::MAX) ? -1 : 1;
+    const auto& obj = tab.tableau[tab.num_constrains];
+
+    duals.resize(tab.num_constrains);
+    for (size_t i = 0; i < tab.num_constrains; ++i) {
+        // rows with negative constant term have been multiplied by -1 inside tableau
+        T row_sign = (constrains[i].b < 0) ? -1 : 1;
+        duals[i] = -sign * row_sign * obj[tab.additional_var_offsets[i]];
+    }
+}
+
+
+/**
+ * @brief method to add a decisional variable to a system solved by optimize and continue the
+ * simplex from the current base, without rebuilding the tableau
+ * 
+ * The column of the new variable is expressed in the current base through the inverse base matrix
+ * held by the columns of the starting slack/artificial base; its reduced cost is cost - duals*column.
+ * A finite upper bound is added as a new LE constrain, whose slack variable enters the base.
+ * The new coefficient is also appended to every constrain, so later optimizations see the variable.
+ * After the network simplex, the tableau of its optimal base is built first.
+ * 
+ * @tparam T
+ * @param solution vector containing the new solution, as written by optimize
+ * @param column coefficient of the new variable in every constrain
+ * @param cost objective function coefficient of the new variable
+ * @param upper_bound non negative upper bound of the new variable, the lower bound is 0 as for every variable
+ * @return LinearConstrainSystem<T>::SolutionType 
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::add_variable(std::vector<T>& solution,
+                                                                                       const std::vector<T>& column,
+                                                                                       const T& cost,
+                                                                                       const T& upper_bound) {
+
+    check_optimal_tableau();
+    if (column.size() != constrains.size()) {
+        throw std::invalid_argument("Wrong number of constrains in column");
+    }
+    if (upper_bound < 0) {
+        throw std::invalid_argument("Upper bound must be non negative");
+    }
+    // the tableau always minimizes: maximization costs have opposite sign inside it
+    T sign = (optimization_type == OptimizationType::MAX) ? -1 : 1;
+    size_t ObjFunc_row = tab.num_constrains;
+    size_t BigM_row = tab.num_constrains + 1;
+    std::vector<bool> artificial;
+    tab.get_artificial_mask(artificial);
+
+    // column in the current base: inverse base matrix times the column of the tableau rows
+    std::vector<T> base_column(tab.tableau.size(), 0);
+    base_column[ObjFunc_row] = sign * cost;
+    for (size_t i = 0; i < constrains.size(); ++i) {
+        // rows with negative constant term have been multiplied by -1 inside tableau
+        T row_value = (constrains[i].b < 0) ? -column[i] : column[i];
+        if (row_value == 0) {
+            continue;
+        }
+        size_t identity_column = tab.additional_var_offsets[i];
+        for (size_t row = 0; row < BigM_row; ++row) {
+            base_column[row] += tab.tableau[row][identity_column] * row_value;
+        }
+        T big_M_cost = artificial[identity_column] ? 1 : 0;
+        base_column[BigM_row] += (tab.tableau[BigM_row][identity_column] - big_M_cost) * row_value;
+    }
+
+    // updating the system
+    for (size_t i = 0; i < constrains.size(); ++i) {
+        constrains[i].a.push_back(column[i]);
+    }
+    objFunc.push_back(cost);
+    tab.add_variable_column(base_column);
+
+    if (upper_bound < std::numeric_limits<T>::max()) {
+        std::vector<T> bound_a(tab.num_variables, 0);
+        bound_a.back() = 1;
+        constrains.emplace_back(bound_a, upper_bound, ConstrainType::LE);
+        tab.add_upper_bound_row(tab.get_total_columns() - 2, upper_bound);
+    }
+
+    // continuing the simplex from the current base
+    optimal_tableau = false;
+    if (run_pivots() == SolutionType::UNBOUNDED) {
+        return SolutionType::UNBOUNDED;
+    }
+    optimal_tableau = true;
+    read_final_tableau(solution, optimization_type);
+    return SolutionType::BOUNDED;
+}
+
+
+/**
+ * @brief method to check that the last optimization left an optimal tableau behind; after the
+ * network simplex, the tableau is built from its spanning tree the first time it is needed
+ * 
+ * @tparam T
+ */
+template<typename T>
+void LinearConstrainSystem<T>::check_optimal_tableau() const {
+    if (network_optimal) {
+        restore_tableau();
+    }
+    if (!optimal_tableau) {
+        throw std::logic_error("Post-optimal analysis requires a bounded optimization to be executed first");
+    }
+}
+
+
+/**
+ * @brief method to build the optimal tableau from the spanning tree of the network simplex
+ * 
+ * Every tree arc is a variable of the base: a decisional variable, the slack or surplus variable of
+ * a row, or an artificial variable left at 0, replaced by the starting base variable of its row.
+ * Tableau::reinvert then brings the base into the initial tableau.
+ * 
+ * @tparam T
+ */
+template<typename T>
+void LinearConstrainSystem<T>::restore_tableau() const {
+
+    size_t decVars_index = tab.get_decVars_index();
+    tab.base.resize(tab.num_constrains);
+    for (size_t node = 0; node < tab.num_constrains; ++node) {
+        size_t arc = network.pred[node];
+        if (arc < network.num_variables) {
+            tab.base[node] = decVars_index + arc;
+            continue;
+        }
+        size_t row = network.is_artificial(arc) ? arc - network.first_artificial : network.opposite(arc, network.root);
+        const Constrain& constrain = constrains[row];
+        // the surplus variable of a GE row follows its artificial variable
+        bool is_GE = constrain.type != ConstrainType::EQ &&
+                     (constrain.type == ConstrainType::GE) == (constrain.b >= 0);
+        tab.base[node] = tab.additional_var_offsets[row] + (is_GE && !network.is_artificial(arc) ? 1 : 0);
+    }
+    tab.reinvert(constrains, objFunc, optimization_type);
+    network_optimal = false;
+    optimal_tableau = true;
+}
+
+
+/**
+ * @brief method to get the variable of a tableau column, independent of the tableau layout, which
+ * changes with the signs of the constant terms
+ * 
+ * Variables are numbered as: decisional variables, then the slack or surplus variable of every
+ * row, then the artificial variable of every row.
+ * 
+ * @tparam T
+ * @param column column of the tableau, constant terms excluded
+ * @return 'size_t' index of the variable
+ */
+template<typename T>
+size_t LinearConstrainSystem<T>::get_basis_variable(size_t column) const {
+
+    size_t decVars_index = tab.get_decVars_index();
+    if (column >= decVars_index) {
+        return column - decVars_index;
+    }
+    // row owning the column, as the last one whose additional variables start before it
+    size_t row = std::upper_bound(tab.additional_var_offsets.begin(), tab.additional_var_offsets.end(), column)
+                 - tab.additional_var_offsets.begin() - 1;
+    const Constrain& constrain = constrains[row];
+    // the surplus variable of a GE row follows its artificial variable
+    bool is_GE = constrain.type != ConstrainType::EQ &&
+                 (constrain.type == ConstrainType::GE) == (constrain.b >= 0);
+    bool is_logical = constrain.type != ConstrainType::EQ && column == tab.additional_var_offsets[row] + (is_GE ? 1 : 0);
+    return tab.num_variables + (is_logical ? 0 : tab.num_constrains) + row;
+}
+
+
+/**
+ * @brief method to build the tableau of the base in basis_variables for c*x
+ * 
+ * The variables of the base are mapped to the columns of the current tableau layout; an artificial
+ * variable of a row that has none any more is replaced by its slack variable. Tableau::reinvert then
+ * brings the base into the initial tableau.
+ * 
+ * @tparam T
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @return true if the whole base has entered the tableau, false if it is singular or malformed
+ */
+template<typename T>
+bool LinearConstrainSystem<T>::load_base(const std::vector<T>& c, const OptimizationType type) {
+
+    size_t decVars_index = tab.get_decVars_index();
+    if (basis_variables.size() != tab.num_constrains) {
+        return false;
+    }
+    tab.base.resize(tab.num_constrains);
+    for (size_t row = 0; row < tab.num_constrains; ++row) {
+        size_t variable = basis_variables[row];
+        if (variable < tab.num_variables) {
+            tab.base[row] = decVars_index + variable;
+            continue;
+        }
+        variable -= tab.num_variables;
+        bool is_logical = variable < tab.num_constrains;
+        size_t base_row = is_logical ? variable : variable - tab.num_constrains;
+        if (base_row >= tab.num_constrains) {
+            return false;
+        }
+        const Constrain& constrain = constrains[base_row];
+        // the surplus variable of a GE row follows its artificial variable
+        bool is_GE = constrain.type != ConstrainType::EQ &&
+                     (constrain.type == ConstrainType::GE) == (constrain.b >= 0);
+        tab.base[row] = tab.additional_var_offsets[base_row] + (is_GE && is_logical ? 1 : 0);
+    }
+    return tab.reinvert(constrains, c, type);
+}
+
+
+/**
+ * @brief method to build the tableau of the base found in basis_cache for c*x
+ * 
+ * The base is accepted if it is not singular and its basic solution satisfies the constrains:
+ * no negative constant term, artificial variables at 0.
+ * 
+ * @tparam T
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @return true if the tableau of the cached base is ready for the simplex, false if a cold start is needed
+ */
+template<typename T>
+bool LinearConstrainSystem<T>::warm_start(const std::vector<T>& c, const OptimizationType type) {
+
+    if (!load_base(c, type)) {
+        return false;
+    }
+
+    T max_b = 0;
+    for (const auto& constrain : constrains) {
+        max_b = std::max(max_b, constrain.b < 0 ? -constrain.b : constrain.b);
+    }
+    T feasibility_tolerance = tab.tolerance * (1 + max_b);
+    for (size_t row = 0; row < tab.num_constrains; ++row) {
+        T& value = tab.tableau[row].back();
+        if (value < -feasibility_tolerance) {
+            return false;
+        }
+        if (value > feasibility_tolerance && get_basis_variable(tab.base[row]) >= tab.num_variables + tab.num_constrains) {
+            return false;
+        }
+        // rounding errors must not make the ratio test negative
+        if (value < 0) {
+            value = 0;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief method to run the floating-point simplex for c*x and verify its result in exact arithmetic
+ * 
+ * A system declared infeasible by the floating-point feasibility test is passed to verify_exact as
+ * well, starting from the base the test has stopped at.
+ * 
+ * @tparam T
+ * @param solution vector where decisional variables and z, rounded to T, are written
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @return LinearConstrainSystem<T>::SolutionType exact result, InfeasibleSystemError is thrown if infeasible
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::run_verified(std::vector<T>& solution,
+                                                                                       const std::vector<T>& c,
+                                                                                       const OptimizationType type) {
+
+    try {
+        if (network_detection && network.load(constrains)) {
+            update_tableau_info();
+            check_valid_objFunc(c, type);
+            objFunc = c;
+            optimization_type = type;
+            run_network(c, type);
+        } else {
+            run_simplex(c, type);
+        }
+    } catch (const InfeasibleSystemError&) {
+        // infeasibility is decided by the exact verification
+    }
+    return read_verified(solution, c, type);
+}
+
+
+/**
+ * @brief method to verify in exact arithmetic the base left by the floating-point simplex for c*x,
+ * writing the exact result rounded to T
+ * 
+ * @tparam T
+ * @param solution vector where decisional variables and z, rounded to T, are written
+ * @param c vector containing objective function coefficients
+ * @param type optimization type
+ * @return LinearConstrainSystem<T>::SolutionType exact result, InfeasibleSystemError is thrown if infeasible
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::read_verified(std::vector<T>& solution,
+                                                                                        const std::vector<T>& c,
+                                                                                        const OptimizationType type) {
+
+    SolutionType sol_type = verify_exact(exact_solution, exact_duals, c, type);
+    if (sol_type == SolutionType::INFEASIBLE) {
+        throw InfeasibleSystemError();
+    }
+    if (sol_type == SolutionType::BOUNDED) {
+        solution.resize(exact_solution.size());
+        for (size_t j = 0; j < exact_solution.size(); ++j) {
+            solution[j] = static_cast<T>(exact_solution[j].to_double());
+        }
+    }
+    return sol_type;
+}
+
+
+/**
+ * @brief method to verify the base left by the last optimization or feasibility test in exact
+ * rational arithmetic, repairing it if needed, see ExactSimplex
+ * 
+ * Constrains and objective function coefficients are converted to Rational exactly. The exact
+ * primal and dual solutions of the base are computed by fraction-free elimination: if both are
+ * feasible the base is certified optimal without pivots, otherwise exact pivots are performed from
+ * it until the exact result is reached; the number of these pivots is returned by get_exact_pivots.
+ * With a bounded result the tableau is rebuilt from the exact optimal base, which post-optimal
+ * analysis then refers to.
+ * 
+ * @tparam T
+ * @param solution vector where the exact decisional variables and z are written, empty if not bounded
+ * @param duals vector where the exact dual value of every constrain is written, empty if not bounded
+ * @param c vector containing objective function coefficients, those of the last optimization to verify it
+ * @param type optimization type
+ * @return LinearConstrainSystem<T>::SolutionType exact result
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::verify_exact(std::vector<Rational>& solution,
+                                                                                       std::vector<Rational>& duals,
+                                                                                       const std::vector<T>& c,
+                                                                                       const OptimizationType type) {
+
+    check_valid_constrains();
+    update_tableau_info();
+    check_valid_objFunc(c, type);
+    if (network_optimal) {
+        restore_tableau();
+    }
+    // variables of the last base, if the tableau still matches the constrains
+    basis_variables.clear();
+    if (tab.base.size() == tab.num_constrains) {
+        for (size_t column : tab.base) {
+            if (column >= tab.get_total_columns() - 1) {
+                basis_variables.clear();
+                break;
+            }
+            basis_variables.push_back(get_basis_variable(column));
+        }
+    }
+
+    exact.load(constrains, c, type);
+    exact_pivots = 0;
+    SolutionType sol_type = exact.solve(basis_variables, exact_pivots);
+    solution.clear();
+    duals.clear();
+    optimal_tableau = false;
+    network_optimal = false;
+    if (sol_type != SolutionType::BOUNDED) {
+        return sol_type;
+    }
+    exact.get_solution(solution, c);
+    exact.get_duals(duals, type);
+    // the tableau follows the exact optimal base
+    objFunc = c;
+    optimization_type = type;
+    feasibility_test = true;
+    exact.get_base(basis_variables);
+    optimal_tableau = load_base(c, type);
+    return sol_type;
+}
+
+
+/**
+ * @brief method to compute, for every objective function coefficient, the interval over which
+ * the base of the last optimization stays optimal when only that coefficient changes
+ * 
+ * @tparam T
+ * @param ranges pair (lower, upper) for every decisional variable, infinite bounds are +-infinity or +-max
+ */
+template<typename T>
+void LinearConstrainSystem<T>::cost_ranging(std::vector<std::pair<T, T>>& ranges) const {
+
+    check_optimal_tableau();
+    // values used for unlimited bounds
+    const T infinity = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    // the tableau always minimizes: maximization coefficients have opposite sign inside it
+    T sign = (optimization_type == OptimizationType::MAX) ? -1 : 1;
+    size_t ObjFunc_row = tab.num_constrains;
+    size_t decVars_index = tab.get_decVars_index();
+    const auto& obj = tab.tableau[ObjFunc_row];
+    // artificial variables can not enter the base again
+    std::vector<bool> artificial;
+    tab.get_artificial_mask(artificial);
+    // position of every column inside the base, num_constrains if not in base
+    std::vector<size_t> base_row(artificial.size(), tab.num_constrains);
+    for (size_t row = 0; row < tab.num_constrains; ++row) {
+        base_row[tab.base[row]] = row;
+    }
+
+    ranges.resize(tab.num_variables);
+    for (size_t j = 0; j < tab.num_variables; ++j) {
+        size_t column = decVars_index + j;
+        // admitted variation of the coefficient inside the tableau
+        T lower = -infinity;
+        T upper = infinity;
+
+        if (base_row[column] == tab.num_constrains) {
+            // a non-base variable stays out while its reduced cost is not negative,
+            // whatever its cost if it would make an artificial variable positive
+            if (!tab.has_big_M_cost(column)) {
+                lower = -obj[column];
+            }
+        } else {
+            // a base variable changes the reduced cost of every non-base variable proportionally to its row
+            const auto& row = tab.tableau[base_row[column]];
+            for (size_t k = 0; k < artificial.size(); ++k) {
+                if (artificial[k] || base_row[k] != tab.num_constrains || tab.has_big_M_cost(k)) {
+                    continue;
+                }
+                if (row[k] > tab.tolerance) {
+                    upper = std::min(upper, obj[k] / row[k]);
+                } else if (row[k] < -tab.tolerance) {
+                    lower = std::max(lower, obj[k] / row[k]);
+                }
+            }
+        }
+        // going back to the coefficients given by the user
+        T coefficient = objFunc[j];
+        if (sign > 0) {
+            ranges[j] = std::make_pair(lower == -infinity ? -infinity : coefficient + lower, upper == infinity ? infinity : coefficient + upper);
+        } else {
+            ranges[j] = std::make_pair(upper == infinity ? -infinity : coefficient - upper, lower == -infinity ? infinity : coefficient - lower);
+        }
+    }
+}
+
+
+/**
+ * @brief method to compute, for every constant term, the interval over which the base
+ * of the last optimization stays feasible (hence optimal) when only that term changes
+ * 
+ * @tparam T
+ * @param ranges pair (lower, upper) for every constrain, infinite bounds are +-infinity or +-max
+ */
+template<typename T>
+void LinearConstrainSystem<T>::rhs_ranging(std::vector<std::pair<T, T>>& ranges) const {
+
+    check_optimal_tableau();
+    const T infinity = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    std::vector<bool> artificial;
+    tab.get_artificial_mask(artificial);
+
+    ranges.resize(tab.num_constrains);
+    for (size_t i = 0; i < tab.num_constrains; ++i) {
+        // column of the inverse base matrix corresponding to this constrain
+        size_t identity_column = tab.additional_var_offsets[i];
+        T lower = -infinity;
+        T upper = infinity;
+
+        for (size_t row = 0; row < tab.num_constrains; ++row) {
+            T direction = tab.tableau[row][identity_column];
+            T value = tab.tableau[row].back();
+            if (direction <= tab.tolerance && direction >= -tab.tolerance) {
+                continue;
+            }
+            if (artificial[tab.base[row]]) {
+                // an artificial variable left in base must stay equal to 0
+                lower = std::max(lower, T(0));
+                upper = std::min(upper, T(0));
+            } else if (direction > 0) {
+                lower = std::max(lower, -value / direction);
+            } else {
+                upper = std::min(upper, -value / direction);
+            }
+        }
+        // rows with negative constant term have been multiplied by -1 inside tableau
+        T b = constrains[i].b;
+        if (b >= 0) {
+            ranges[i] = std::make_pair(lower == -infinity ? -infinity : b + lower, upper == infinity ? infinity : b + upper);
+        } else {
+            ranges[i] = std::make_pair(upper == infinity ? -infinity : b - upper, lower == -infinity ? infinity : b - lower);
+        }
+    }
+}
+
+
+/**
+ * @brief method to compute the optimal value z(t) of the problem with constant terms b + t*direction,
+ * for t going from 0 to t_max, starting from the optimal tableau of the last optimization
+ * 
+ * Every time a base variable reaches 0 a dual simplex pivot changes the base, so z(t) is obtained
+ * as a piecewise linear function without solving the problem again.
+ * 
+ * @tparam T
+ * @param direction variation of the constant term of every constrain
+ * @param t_max last value of the parameter
+ * @param breakpoints pairs (t, z(t)) where the base changes, the first is t = 0 and the last is where the sweep stops
+ * @return BOUNDED if t_max is reached, INFEASIBLE if the system has no solution past the last breakpoint
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::parametric_rhs(const std::vector<T>& direction,
+                                                                                         const T& t_max,
+                                                                                         std::vector<std::pair<T, T>>& breakpoints) const {
+
+    check_optimal_tableau();
+    if (direction.size() != tab.num_constrains) {
+        throw std::invalid_argument("Wrong number of constant terms in direction");
+    }
+    // working on a copy to keep the optimal tableau available
+    Tableau<T> work(tab);
+    size_t ObjFunc_row = work.num_constrains;
+    T sign = (optimization_type == OptimizationType::MAX) ? -1 : 1;
+    std::vector<bool> artificial;
+    work.get_artificial_mask(artificial);
+
+    // direction of the constant term column: inverse base matrix times the direction of the tableau rows
+    std::vector<T> delta(work.tableau.size(), 0);
+    for (size_t i = 0; i < work.num_constrains; ++i) {
+        // rows with negative constant term have been multiplied by -1 inside tableau
+        T row_direction = (constrains[i].b < 0) ? -direction[i] : direction[i];
+        if (row_direction == 0) {
+            continue;
+        }
+        size_t identity_column = work.additional_var_offsets[i];
+        for (size_t row = 0; row < work.num_constrains; ++row) {
+            delta[row] += work.tableau[row][identity_column] * row_direction;
+        }
+        // objective function rows change by -(dual value)*direction, M costs 1 on artificial variables
+        delta[ObjFunc_row] += work.tableau[ObjFunc_row][identity_column] * row_direction;
+        T big_M_cost = artificial[identity_column] ? 1 : 0;
+        delta[ObjFunc_row + 1] += (work.tableau[ObjFunc_row + 1][identity_column] - big_M_cost) * row_direction;
+    }
+
+    T t = 0;
+    breakpoints.clear();
+    breakpoints.emplace_back(t, -sign * work.tableau[ObjFunc_row].back());
+    while (t < t_max) {
+        // largest step keeping every base variable feasible
+        T step = t_max - t;
+        int pivot_row = -1;
+        for (size_t row = 0; row < work.num_constrains; ++row) {
+            if (artificial[work.base[row]]) {
+                // an artificial variable in base must leave as soon as it would change
+                if (delta[row] > work.tolerance || delta[row] < -work.tolerance) {
+                    step = 0;
+                    pivot_row = row;
+                    break;
+                }
+            } else if (delta[row] < -work.tolerance && -work.tableau[row].back() / delta[row] < step) {
+                step = -work.tableau[row].back() / delta[row];
+                pivot_row = row;
+            }
+        }
+        // moving along the direction up to the next change of base
+        for (size_t row = 0; row < work.tableau.size(); ++row) {
+            work.tableau[row].back() += step * delta[row];
+        }
+        t += step;
+        if (step > 0 || pivot_row == -1) {
+            breakpoints.emplace_back(t, -sign * work.tableau[ObjFunc_row].back());
+        }
+        if (pivot_row == -1) {
+            break;
+        }
+
+        // dual ratio test: the entering variable keeps every reduced cost non negative, comparing
+        // ratios lexicographically on (M part, real part) as pricing does; columns with an M cost
+        // can enter, e.g. in place of an artificial variable at 0 leaving the base
+        // (a leaving variable growing past 0 is an artificial one, which leaves with a positive pivot)
+        T leaving_sign = (delta[pivot_row] < 0) ? -1 : 1;
+        int pivot_column = -1;
+        T min_big_M_ratio = 0;
+        T min_ratio = 0;
+        for (size_t col = 0; col < artificial.size(); ++col) {
+            T element = leaving_sign * work.tableau[pivot_row][col];
+            if (artificial[col] || element <= work.tolerance) {
+                continue;
+            }
+            T big_M_ratio = work.has_big_M_cost(col) ? work.tableau[ObjFunc_row + 1][col] / element : 0;
+            T ratio = work.tableau[ObjFunc_row][col] / element;
+            if (pivot_column == -1 || big_M_ratio < min_big_M_ratio - work.big_M_tolerance ||
+                (big_M_ratio <= min_big_M_ratio + work.big_M_tolerance && ratio < min_ratio)) {
+                min_big_M_ratio = big_M_ratio;
+                min_ratio = ratio;
+                pivot_column = col;
+            }
+        }
+        if (pivot_column == -1) {
+            // nothing can replace the leaving variable: no solution past t
+            return SolutionType::INFEASIBLE;
+        }
+        work.transform_column(pivot_row, pivot_column, delta);
+        work.pivot(pivot_row, pivot_column);
+    }
+    return SolutionType::BOUNDED;
+}
+
+
+/**
+ * @brief method to compute the optimal value z(t) of the problem with objective function c + t*direction,
+ * for t going from 0 to t_max, starting from the optimal tableau of the last optimization
+ * 
+ * Every time a reduced cost reaches 0 a primal simplex pivot changes the base, so z(t) is obtained
+ * as a piecewise linear function without solving the problem again.
+ * 
+ * @tparam T
+ * @param direction variation of every objective function coefficient
+ * @param t_max last value of the parameter
+ * @param breakpoints pairs (t, z(t)) where the base changes, the first is t = 0 and the last is where the sweep stops
+ * @return BOUNDED if t_max is reached, UNBOUNDED if the problem is unbounded past the last breakpoint
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType LinearConstrainSystem<T>::parametric_cost(const std::vector<T>& direction,
+                                                                                          const T& t_max,
+                                                                                          std::vector<std::pair<T, T>>& breakpoints) const {
+
+    check_optimal_tableau();
+    if (direction.size() != tab.num_variables) {
+        throw std::invalid_argument("Wrong number of variables in direction");
+    }
+    // working on a copy to keep the optimal tableau available
+    Tableau<T> work(tab);
+    size_t ObjFunc_row = work.num_constrains;
+    size_t decVars_index = work.get_decVars_index();
+    T sign = (optimization_type == OptimizationType::MAX) ? -1 : 1;
+    std::vector<bool> artificial;
+    work.get_artificial_mask(artificial);
+
+    // direction of the objective function row: costs minus the combination of rows pricing out the base
+    std::vector<T> delta(work.get_total_columns(), 0);
+    for (size_t j = 0; j < work.num_variables; ++j) {
+        delta[decVars_index + j] = sign * direction[j];
+    }
+    for (size_t row = 0; row < work.num_constrains; ++row) {
+        T factor = delta[work.base[row]];
+        if (factor == 0) {
+            continue;
+        }
+        for (size_t col = 0; col < delta.size(); ++col) {
+            delta[col] -= factor * work.tableau[row][col];
+        }
+    }
+
+    T t = 0;
+    breakpoints.clear();
+    breakpoints.emplace_back(t, -sign * work.tableau[ObjFunc_row].back());
+    auto& obj = work.tableau[ObjFunc_row];
+    while (t < t_max) {
+        // largest step keeping every reduced cost non negative
+        T step = t_max - t;
+        int pivot_column = -1;
+        for (size_t col = 0; col < artificial.size(); ++col) {
+            if (!artificial[col] && !work.has_big_M_cost(col) && delta[col] < -work.tolerance && -obj[col] / delta[col] < step) {
+                step = -obj[col] / delta[col];
+                pivot_column = col;
+            }
+        }
+        // moving along the direction up to the next change of base
+        for (size_t col = 0; col < delta.size(); ++col) {
+            obj[col] += step * delta[col];
+        }
+        t += step;
+        if (step > 0 || pivot_column == -1) {
+            breakpoints.emplace_back(t, -sign * obj.back());
+        }
+        if (pivot_column == -1) {
+            break;
+        }
+
+        // primal ratio test
+        int pivot_row = work.find_pivot_row(pivot_column);
+        if (pivot_row == -1) {
+            return SolutionType::UNBOUNDED;
+        }
+        // the direction row follows the same row operations as the objective function row
+        T factor = delta[pivot_column] / work.tableau[pivot_row][pivot_column];
+        for (size_t col = 0; col < delta.size(); ++col) {
+            delta[col] -= factor * work.tableau[pivot_row][col];
+        }
+        work.pivot(pivot_row, pivot_column);
+    }
+    return SolutionType::BOUNDED;
+}
+
+
+/**
+ * @brief  method to print input optimization problem
+ * 
+ * @tparam T 
+ * @param c coefficients of objective function vector
+ * @param type optimization type
+ */
+template<typename T>
+void LinearConstrainSystem<T>::print_Lcs(const std::vector<T>& c, const OptimizationType type) const {
+
+    std::cout<< "Optimization problem: "<< std::endl<< std::endl;
+    std::cout << (type == OptimizationType::MIN ? "Minimize: " : "Maximize: ") << c[0] << "x1";
+    for (size_t i = 1; i < c.size(); ++i) {
+        if (c[i] >= 0) {
+            std::cout << " + " << c[i] << "x" << (i + 1);
+        } else {
+            std::cout << " - " << -c[i] << "x" << (i + 1);
+        }
+    }
+    std::cout << std::endl << "Subject to:" << std::endl;
+
+    for (const auto &constrain : constrains) {
+        std::cout << constrain.a[0]<< "x1";
+        for (size_t i = 1; i < constrain.a.size(); ++i) {
+            if (constrain.a[i] >= 0) {
+                std::cout << " + " << constrain.a[i] << "x" << (i + 1);
+            } else {
+                std::cout << " - " << -constrain.a[i] << "x" << (i + 1);
+            }
+        }
+
+        switch (constrain.type) {
+            case ConstrainType::LE:
+                std::cout << " <= ";
+                break;
+            case ConstrainType::GE:
+                std::cout << " >= ";
+                break;
+            case ConstrainType::EQ:
+                std::cout << " = ";
+                break;
+        }
+        std::cout << constrain.b << std::endl;
+    }
+
+}
+
+/**
+ * @brief method to print optimal solution found for the optimization problem
+ * 
+ * @tparam T
+ * @param type optimization type
+ * @param solution vector containing solution
+ */
+template<typename T>  
+void LinearConstrainSystem<T>::print_result(SolutionType type, std::vector<T>& solution) const {
+
+    // BOUNDED case
+    if (type == LinearConstrainSystem<T>::SolutionType::BOUNDED) {
+        
+        std::cout << std::endl;  
+        std::cout << "Bounded solution found:" << std::endl;
+
+        for (size_t i = 0; i < solution.size()-1; i++) {
+            
+            std::cout << "x" << i + 1 << " = " << solution[i] << std::endl;           
+        }
+        std::cout << std::endl; 
+
+        std::cout<< "Optimal value z= "<< solution.back() << std::endl<< std::endl;
+
+    // UNBOUNDED case
+    } else if (type == LinearConstrainSystem<T>::SolutionType::UNBOUNDED) {
+        std::cout << "UNBOUNDED SOLUTION" << std::endl<< std::endl;
+    // INFEASIBLE case
+    } else {
+        std::cout << "INFEASIBLE SYSTEM" << std::endl<< std::endl;
     }
 }
 
@@ -0,0 +1,320 @@
+#ifndef __MAPPEDSTORAGE_HPP__
+#define __MAPPEDSTORAGE_HPP__
+
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define SIMPLEX_HAS_MMAP
+#endif
+
+
+/**
+ * @brief class for a storage area kept in a memory-mapped scratch file
+ *
+ * The file grows in chunks of chunk_bytes: every chunk is mapped separately and blocks are handed
+ * out one after the other, so tableau rows allocated in order lie in the file in the same order.
+ * Pages are written back to the file by the kernel instead of filling RAM or swap. The file is
+ * unlinked as soon as it is created, so it disappears with the last mapping even if the program is
+ * killed. Available on POSIX systems only, elsewhere the constructor throws std::runtime_error.
+ *
+ * Released blocks are merged with released neighbours and reused, split if larger than needed, so
+ * rows reallocated to a larger size (e.g. by add_variable) do not make the file grow without end.
+ *
+ * Only tableau rows are kept here, see LinearConstrainSystem::set_scratch_file for what stays in RAM.
+ * Chunks are only hinted as sequential to the kernel: pivot does not schedule its reads by chunk,
+ * it updates rows in row order, which is the order of the file unless rows have been reallocated.
+ */
+class MappedArena {
+
+    int file{-1};                   //!< file descriptor of the scratch file
+    size_t chunk_bytes;             //!< size of every chunk mapped at once, multiple of the page size
+    size_t file_size{0};            //!< current size of the scratch file
+    std::vector<std::pair<char*, size_t>> chunks;    //!< mapped chunks with their size
+    char* next_block{nullptr};      //!< first free byte of the last chunk
+    size_t bytes_left{0};           //!< free bytes at the end of the last chunk
+    std::map<char*, size_t> free_blocks;            //!< released blocks by address, with their size
+    std::multimap<size_t, char*> free_sizes;        //!< released blocks by size, for the best fit of allocate
+    std::mutex mutex;               //!< rows can be allocated by several threads at once
+
+    static const size_t ALIGNMENT = 64;    //!< alignment of every block, a cache line
+
+  public:
+
+    // constructor creating the scratch file
+    MappedArena(const std::string& path, size_t chunk_bytes);
+    // destructor unmapping chunks and closing the scratch file
+    ~MappedArena();
+    MappedArena(const MappedArena&) = delete;
+    MappedArena& operator=(const MappedArena&) = delete;
+
+    // method to get a block of at least bytes bytes
+    void* allocate(size_t bytes);
+    // method to release a block got from allocate
+    void deallocate(void* block, size_t bytes);
+    // method to get the size of the scratch file
+    size_t size();
+
+  private:
+
+    // method to add a released block to the free lists
+    void insert_free(char* block, size_t bytes);
+    // method to remove a released block from the free lists
+    void erase_free(std::map<char*, size_t>::iterator released);
+};
+
+
+/**
+ * @brief Constructor creating the scratch file
+ *
+ * @param path path of the scratch file, which is unlinked immediately
+ * @param chunk_bytes size of the chunks the file grows by, rounded up to a multiple of the page size
+ */
+inline MappedArena::MappedArena(const std::string& path, size_t chunk_bytes) {
+
+    #ifdef SIMPLEX_HAS_MMAP
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    this->chunk_bytes = (chunk_bytes + page - 1) / page * page;
+    if (this->chunk_bytes == 0) {
+        this->chunk_bytes = page;
+    }
+    file = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (file == -1) {
+        throw std::runtime_error("Cannot create scratch file " + path);
+    }
+    unlink(path.c_str());
+    #else
+    (void)path;
+    (void)chunk_bytes;
+    throw std::runtime_error("Memory-mapped storage is not supported on this platform");
+    #endif // SIMPLEX_HAS_MMAP
+}
+
+
+/**
+ * @brief Destructor unmapping chunks and closing the scratch file
+ */
+inline MappedArena::~MappedArena() {
+
+    #ifdef SIMPLEX_HAS_MMAP
+    for (const auto& chunk : chunks) {
+        munmap(chunk.first, chunk.second);
+    }
+    if (file != -1) {
+        close(file);
+    }
+    #endif // SIMPLEX_HAS_MMAP
+}
+
+
+/**
+ * @brief method to get a block of at least bytes bytes: the smallest released block large enough if
+ * any, whose remainder stays released, otherwise the next free bytes of the last chunk, mapping a
+ * new chunk when it is full
+ *
+ * @param bytes requested size
+ * @return 'void*' pointer to the block, std::bad_alloc is thrown if the file can not grow
+ */
+inline void* MappedArena::allocate(size_t bytes) {
+
+    bytes = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto fit = free_sizes.lower_bound(bytes);
+    if (fit != free_sizes.end()) {
+        char* block = fit->second;
+        size_t size = fit->first;
+        erase_free(free_blocks.find(block));
+        if (size > bytes) {
+            insert_free(block + bytes, size - bytes);
+        }
+        return block;
+    }
+
+    #ifdef SIMPLEX_HAS_MMAP
+    if (bytes > bytes_left) {
+        // blocks larger than a chunk get a chunk of their own
+        size_t size = bytes > chunk_bytes ? (bytes + chunk_bytes - 1) / chunk_bytes * chunk_bytes : chunk_bytes;
+        if (ftruncate(file, static_cast<off_t>(file_size + size)) != 0) {
+            throw std::bad_alloc();
+        }
+        void* chunk = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, static_cast<off_t>(file_size));
+        if (chunk == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        // rows are updated from the first to the last one
+        madvise(chunk, size, MADV_SEQUENTIAL);
+        // the rest of the last chunk is not lost
+        if (bytes_left > 0) {
+            insert_free(next_block, bytes_left);
+        }
+        chunks.emplace_back(static_cast<char*>(chunk), size);
+        file_size += size;
+        next_block = static_cast<char*>(chunk);
+        bytes_left = size;
+    }
+    #endif // SIMPLEX_HAS_MMAP
+
+    void* block = next_block;
+    next_block += bytes;
+    bytes_left -= bytes;
+    return block;
+}
+
+
+/**
+ * @brief method to release a block got from allocate: it is merged with the released blocks next to
+ * it in the same chunk and given back to the end of the last chunk if it lies there, the file never
+ * shrinks
+ *
+ * @param block pointer to the block
+ * @param bytes size requested for the block
+ */
+inline void MappedArena::deallocate(void* block, size_t bytes) {
+
+    bytes = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    char* start = static_cast<char*>(block);
+    // chunks are mapped separately, so blocks are merged only within the chunk holding them
+    char* chunk_start = nullptr;
+    char* chunk_end = nullptr;
+    for (const auto& chunk : chunks) {
+        if (chunk.first <= start && start < chunk.first + chunk.second) {
+            chunk_start = chunk.first;
+            chunk_end = chunk.first + chunk.second;
+            break;
+        }
+    }
+    auto next = free_blocks.lower_bound(start);
+    if (next != free_blocks.end() && next->first == start + bytes && next->first < chunk_end) {
+        bytes += next->second;
+        erase_free(next);
+    }
+    next = free_blocks.lower_bound(start);
+    if (next != free_blocks.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == start && previous->first >= chunk_start) {
+            start = previous->first;
+            bytes += previous->second;
+            erase_free(previous);
+        }
+    }
+    if (start + bytes == next_block && !chunks.empty() && chunk_start == chunks.back().first) {
+        next_block = start;
+        bytes_left += bytes;
+    } else {
+        insert_free(start, bytes);
+    }
+}
+
+
+/**
+ * @brief method to get the size of the scratch file
+ *
+ * @return 'size_t' bytes mapped so far, the file never shrinks
+ */
+inline size_t MappedArena::size() {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return file_size;
+}
+
+
+/**
+ * @brief method to add a released block to the free lists
+ *
+ * @param block pointer to the block
+ * @param bytes size of the block, multiple of ALIGNMENT
+ */
+inline void MappedArena::insert_free(char* block, size_t bytes) {
+
+    free_blocks.emplace(block, bytes);
+    free_sizes.emplace(bytes, block);
+}
+
+
+/**
+ * @brief method to remove a released block from the free lists
+ *
+ * @param released position of the block in free_blocks
+ */
+inline void MappedArena::erase_free(std::map<char*, size_t>::iterator released) {
+
+    auto range = free_sizes.equal_range(released->second);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == released->first) {
+            free_sizes.erase(it);
+            break;
+        }
+    }
+    free_blocks.erase(released);
+}
+
+
+/**
+ * @brief allocator for tableau rows: rows live in a MappedArena when one is set, on the heap otherwise
+ *
+ * The arena is shared by all copies of the allocator and released with the last of them.
+ *
+ * @tparam T is the parametric type
+ */
+template<typename T>
+struct MappedAllocator {
+
+    typedef T value_type;
+
+    std::shared_ptr<MappedArena> arena;    //!< storage of the rows, null for the heap
+
+    // empty constructor, for heap storage
+    MappedAllocator() {}
+    /**
+     * @brief constructor for storage in arena
+     */
+    MappedAllocator(const std::shared_ptr<MappedArena>& arena) : arena(arena) {}
+    /**
+     * @brief constructor from the allocator of another type, sharing its arena
+     */
+    template<typename U>
+    MappedAllocator(const MappedAllocator<U>& other) : arena(other.arena) {}
+
+    /**
+     * @brief method to allocate n elements
+     */
+    T* allocate(size_t n) {
+        if (!arena) {
+            return std::allocator<T>().allocate(n);
+        }
+        return static_cast<T*>(arena->allocate(n * sizeof(T)));
+    }
+    /**
+     * @brief method to release n elements got from allocate
+     */
+    void deallocate(T* pointer, size_t n) {
+        if (!arena) {
+            std::allocator<T>().deallocate(pointer, n);
+        } else {
+            arena->deallocate(pointer, n * sizeof(T));
+        }
+    }
+};
+
+
+template<typename T, typename U>
+inline bool operator==(const MappedAllocator<T>& lhs, const MappedAllocator<U>& rhs) { return lhs.arena == rhs.arena; }
+
+template<typename T, typename U>
+inline bool operator!=(const MappedAllocator<T>& lhs, const MappedAllocator<U>& rhs) { return lhs.arena != rhs.arena; }
+
+#endif // __MAPPEDSTORAGE_HPP__
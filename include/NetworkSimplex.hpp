@@ -0,0 +1,668 @@
+#ifndef __NETWORKSIMPLEX_HPP__
+#define __NETWORKSIMPLEX_HPP__
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+
+template<typename T>
+struct LinearConstrainSystem;
+
+
+
+/**
+ * @brief class for the network simplex, used by LinearConstrainSystem in place of the tableau when
+ * the constrain system is the node-arc incidence matrix of a network
+ *
+ * This is the case when every column has at most two nonzero elements, of opposite sign, once every
+ * row has been multiplied by a suitable factor: e.g. transportation and assignment problems, where
+ * demand rows are multiplied by -1. Every row becomes a node, every decisional variable an arc from
+ * the row of its +1 to the row of its -1, and a root node closes the arcs with a single nonzero
+ * element. Slack and surplus variables are arcs between a node and the root, as the artificial
+ * variables of the starting base.
+ *
+ * The base is a spanning tree rooted in the root node, kept with the parent, the arc towards it, the
+ * depth and the list of children of every node: a pivot only reverses the tree path between the
+ * entering arc and the leaving one, and updates depth and potentials of the subtree that moves. As in Tableau, the cost of artificial variables is kept apart from the
+ * real costs: every node has a potential for both of them, compared lexicographically. Leaving arcs
+ * are chosen so that the tree stays strongly feasible, which prevents cycling on degenerate pivots.
+ * Memory and time per pivot grow with the number of nodes and arcs instead of the size of the tableau.
+ *
+ * @tparam T
+ */
+template<typename T>
+class NetworkSimplex {
+
+    static const size_t NONE = std::numeric_limits<size_t>::max();     //!< missing node or arc
+
+    size_t num_variables{0};                //!< number of decisional variables, i.e. arcs 0..num_variables-1
+    size_t num_constrains{0};               //!< number of constrains, i.e. nodes 0..num_constrains-1
+    size_t root{0};                         //!< index of the root node, equal to num_constrains
+    size_t first_artificial{0};             //!< index of the first arc of an artificial variable, one for every node
+    std::vector<size_t> arc_tail;           //!< node left by every arc, i.e. row of its +1
+    std::vector<size_t> arc_head;           //!< node reached by every arc, i.e. row of its -1
+    std::vector<T> arc_cost;                //!< real cost of every arc
+    std::vector<T> arc_flow;                //!< value of the variable of every arc
+    std::vector<T> coefficients;            //!< buffer for the two nonzero elements of every column during detection
+    std::vector<T> row_scale;               //!< factor making the nonzero elements of every row equal to +1 or -1
+    std::vector<T> supply;                  //!< constant term of every row after scaling
+    std::vector<size_t> parent;             //!< parent of every node in the spanning tree
+    std::vector<size_t> pred;               //!< arc between every node and its parent
+    std::vector<size_t> depth;              //!< depth of every node in the spanning tree
+    std::vector<size_t> first_child;        //!< first child of every node in the spanning tree
+    std::vector<size_t> next_sibling;       //!< next child of the parent of every node
+    std::vector<size_t> prev_sibling;       //!< previous child of the parent of every node
+    std::vector<T> potential;               //!< potential of every node for real costs
+    std::vector<T> big_M_potential;         //!< potential of every node for the costs of artificial variables
+    std::vector<size_t> adjacency_offsets;  //!< buffer for the first adjacent arc of every node
+    std::vector<size_t> adjacency;          //!< buffer for the arcs adjacent to every node
+    std::vector<size_t> order;              //!< buffer for nodes still to be visited
+    size_t next_arc{0};                     //!< first arc of the next block scanned by find_entering_arc
+    T tolerance = std::numeric_limits<T>::epsilon() * 1024; //!< values whose magnitude is below tolerance are treated as 0
+    T cost_tolerance = tolerance;           //!< tolerance of reduced costs, scaled by the objective function
+    T flow_tolerance = tolerance;           //!< tolerance of flows, scaled by the constant terms
+
+    // empty constructor
+    NetworkSimplex() {}
+
+    /**
+     * @brief method to check whether an arc is the one of an artificial variable
+     */
+    inline bool is_artificial(size_t arc) const { return arc >= first_artificial; }
+    /**
+     * @brief method to get the other end of an arc adjacent to node
+     */
+    inline size_t opposite(size_t arc, size_t node) const { return arc_tail[arc] == node ? arc_head[arc] : arc_tail[arc]; }
+
+    // method to detect network structure and build the nodes and arcs of the constrain system
+    bool load(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains);
+    // method to minimize or maximize c*x over the network loaded by load
+    typename LinearConstrainSystem<T>::SolutionType solve(const std::vector<T>& c, const typename LinearConstrainSystem<T>::OptimizationType type,
+                                                          size_t& pivots);
+    // method to build parent, children, depth and potentials of every node from the arcs towards the parents
+    void build_tree();
+    // method to replace a tree arc by the entering arc, updating only the subtree that moves
+    void update_tree(size_t leaving_arc, size_t entering_arc);
+    // method to set depth and potentials of the nodes of a subtree from the parent of its root
+    void update_subtree(size_t node);
+    // method to add a node to the children of another one
+    void link_child(size_t node, size_t child);
+    // method to remove a node from the children of its parent
+    void unlink_child(size_t child);
+    // method to identify the arc entering the spanning tree
+    size_t find_entering_arc(bool big_M_only);
+    // method to identify the arc leaving the spanning tree
+    size_t find_leaving_arc(size_t entering_arc, T& delta) const;
+    // method to push flow along the cycle closed by the entering arc
+    void push_flow(size_t entering_arc, const T& delta);
+    // method to check whether an artificial variable is still positive
+    bool has_positive_artificial() const;
+    // method to write decisional variables and z
+    void get_solution(std::vector<T>& solution, const std::vector<T>& c) const;
+    // method to get the dual value of every constrain from node potentials
+    void get_duals(std::vector<T>& duals, const typename LinearConstrainSystem<T>::OptimizationType type) const;
+
+    friend struct LinearConstrainSystem<T>;
+};
+
+template<typename T>
+const size_t NetworkSimplex<T>::NONE;
+
+
+/**
+ * @brief method to detect network structure and build the nodes and arcs of the constrain system
+ *
+ * The nonzero elements of a row must have the same magnitude, which the row is divided by. The sign
+ * of every row then follows from the columns with two nonzero elements, which must become +1 and -1:
+ * the rows are visited through these columns, and a row reached with both signs rejects the system.
+ *
+ * @tparam T
+ * @param constrains vector of Constrain objects to represent system constrains
+ * @return true if the system has network structure, false otherwise
+ */
+template<typename T>
+bool NetworkSimplex<T>::load(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains) {
+
+    num_constrains = constrains.size();
+    num_variables = constrains[0].a.size();
+    root = num_constrains;
+
+    // rows of the nonzero elements of every column, root if missing
+    arc_tail.assign(num_variables, root);
+    arc_head.assign(num_variables, root);
+    coefficients.resize(2 * num_variables);
+    row_scale.assign(num_constrains, 0);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        const std::vector<T>& a = constrains[row].a;
+        T magnitude = 0;
+        for (size_t j = 0; j < num_variables; ++j) {
+            if (a[j] == 0) {
+                continue;
+            }
+            if (magnitude == 0) {
+                magnitude = std::abs(a[j]);
+            } else if (std::abs(std::abs(a[j]) - magnitude) > tolerance * magnitude) {
+                return false;
+            }
+            if (arc_tail[j] == root) {
+                arc_tail[j] = row;
+                coefficients[2 * j] = a[j];
+            } else if (arc_head[j] == root) {
+                arc_head[j] = row;
+                coefficients[2 * j + 1] = a[j];
+            } else {
+                return false;
+            }
+        }
+        row_scale[row] = (magnitude == 0) ? 1 : 1 / magnitude;
+    }
+
+    // columns with two nonzero elements adjacent to every row
+    adjacency_offsets.assign(num_constrains + 2, 0);
+    for (size_t j = 0; j < num_variables; ++j) {
+        if (arc_head[j] != root) {
+            adjacency_offsets[arc_tail[j] + 2]++;
+            adjacency_offsets[arc_head[j] + 2]++;
+        }
+    }
+    for (size_t row = 0; row < num_constrains; ++row) {
+        adjacency_offsets[row + 2] += adjacency_offsets[row + 1];
+    }
+    adjacency.resize(adjacency_offsets[num_constrains + 1]);
+    for (size_t j = 0; j < num_variables; ++j) {
+        if (arc_head[j] != root) {
+            adjacency[adjacency_offsets[arc_tail[j] + 1]++] = j;
+            adjacency[adjacency_offsets[arc_head[j] + 1]++] = j;
+        }
+    }
+
+    // signs of rows, visiting every connected group of rows from its first one
+    // (depth is used as the visited flag)
+    depth.assign(num_constrains, 0);
+    order.clear();
+    for (size_t first = 0; first < num_constrains; ++first) {
+        if (depth[first] != 0) {
+            continue;
+        }
+        depth[first] = 1;
+        order.push_back(first);
+        for (size_t visited = order.size() - 1; visited < order.size(); ++visited) {
+            size_t row = order[visited];
+            for (size_t k = adjacency_offsets[row]; k < adjacency_offsets[row + 1]; ++k) {
+                size_t j = adjacency[k];
+                size_t other_row = opposite(j, row);
+                T coefficient = coefficients[arc_tail[j] == row ? 2 * j : 2 * j + 1];
+                T other_coefficient = coefficients[arc_tail[j] == row ? 2 * j + 1 : 2 * j];
+                // the two elements of the column must have opposite sign after scaling
+                bool same_sign = (row_scale[row] * coefficient > 0) == (other_coefficient > 0);
+                T other_scale = same_sign ? -std::abs(row_scale[other_row]) : std::abs(row_scale[other_row]);
+                if (depth[other_row] == 0) {
+                    row_scale[other_row] = other_scale;
+                    depth[other_row] = 1;
+                    order.push_back(other_row);
+                } else if ((row_scale[other_row] > 0) != (other_scale > 0)) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // every decisional variable goes from the row of its +1 to the row of its -1,
+    // zero columns are loops on the root
+    for (size_t j = 0; j < num_variables; ++j) {
+        if (arc_tail[j] != root && row_scale[arc_tail[j]] * coefficients[2 * j] < 0) {
+            std::swap(arc_tail[j], arc_head[j]);
+        }
+    }
+
+    // slack variables of LE rows leave their node, surplus variables of GE rows reach it
+    supply.resize(num_constrains);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        const auto& constrain = constrains[row];
+        supply[row] = row_scale[row] * constrain.b;
+        if (constrain.type == LinearConstrainSystem<T>::ConstrainType::EQ) {
+            continue;
+        }
+        // rows multiplied by a negative factor change type
+        bool is_LE = (constrain.type == LinearConstrainSystem<T>::ConstrainType::LE) == (row_scale[row] > 0);
+        arc_tail.push_back(is_LE ? row : root);
+        arc_head.push_back(is_LE ? root : row);
+    }
+
+    // artificial variables of the starting base, towards the root for non negative supplies
+    first_artificial = arc_tail.size();
+    for (size_t row = 0; row < num_constrains; ++row) {
+        arc_tail.push_back(supply[row] >= 0 ? row : root);
+        arc_head.push_back(supply[row] >= 0 ? root : row);
+    }
+    return true;
+}
+
+
+/**
+ * @brief method to minimize or maximize c*x over the network loaded by load
+ *
+ * The starting tree is made of the arcs of artificial variables, carrying the supply of every node.
+ * Entering arcs are searched by blocks of arcs; artificial variables never enter again once they have
+ * left the tree. If an entering arc can grow without limit while an artificial variable is still
+ * positive, the system may be infeasible: the simplex goes on with the costs of artificial variables
+ * only, to decide between infeasible and unbounded.
+ *
+ * @tparam T
+ * @param c vector of objective function coefficients
+ * @param type optimization type
+ * @param pivots number of pivots performed
+ * @return BOUNDED if the flow is optimal, UNBOUNDED or INFEASIBLE otherwise
+ */
+template<typename T>
+typename LinearConstrainSystem<T>::SolutionType NetworkSimplex<T>::solve(const std::vector<T>& c, const typename LinearConstrainSystem<T>::OptimizationType type,
+                                                                         size_t& pivots) {
+
+    // the network simplex always minimizes: maximization costs have opposite sign
+    T sign = (type == LinearConstrainSystem<T>::OptimizationType::MAX) ? -1 : 1;
+    arc_cost.assign(arc_tail.size(), 0);
+    T max_cost = 1;
+    for (size_t j = 0; j < num_variables; ++j) {
+        arc_cost[j] = sign * c[j];
+        max_cost = std::max(max_cost, std::abs(c[j]));
+    }
+    T total_supply = 1;
+    for (const auto& value : supply) {
+        total_supply += std::abs(value);
+    }
+    cost_tolerance = tolerance * max_cost;
+    flow_tolerance = tolerance * total_supply;
+
+    // starting tree: every node is a child of the root through its artificial variable
+    arc_flow.assign(arc_tail.size(), 0);
+    pred.resize(num_constrains + 1);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        arc_flow[first_artificial + row] = std::abs(supply[row]);
+        pred[row] = first_artificial + row;
+    }
+    pred[root] = NONE;
+    build_tree();
+    next_arc = 0;
+
+    pivots = 0;
+    bool big_M_only = false;
+    while (true) {
+        size_t entering_arc = find_entering_arc(big_M_only);
+        if (entering_arc == NONE) {
+            break;
+        }
+        T delta = 0;
+        size_t leaving_arc = find_leaving_arc(entering_arc, delta);
+        if (leaving_arc == NONE) {
+            if (!has_positive_artificial()) {
+                return LinearConstrainSystem<T>::SolutionType::UNBOUNDED;
+            }
+            // a ray of the network, but no feasible flow found yet
+            big_M_only = true;
+            continue;
+        }
+        push_flow(entering_arc, delta);
+        arc_flow[leaving_arc] = 0;
+        update_tree(leaving_arc, entering_arc);
+        pivots++;
+    }
+
+    if (has_positive_artificial()) {
+        return LinearConstrainSystem<T>::SolutionType::INFEASIBLE;
+    }
+    // an unbounded ray found while looking for a feasible flow
+    return big_M_only ? LinearConstrainSystem<T>::SolutionType::UNBOUNDED : LinearConstrainSystem<T>::SolutionType::BOUNDED;
+}
+
+
+/**
+ * @brief method to build parent, children, depth and potentials of every node from pred, the arcs
+ * towards the parents, visiting the tree from the root
+ *
+ * @tparam T
+ */
+template<typename T>
+void NetworkSimplex<T>::build_tree() {
+
+    size_t num_nodes = num_constrains + 1;
+    parent.resize(num_nodes);
+    depth.resize(num_nodes);
+    potential.resize(num_nodes);
+    big_M_potential.resize(num_nodes);
+    first_child.assign(num_nodes, NONE);
+    next_sibling.assign(num_nodes, NONE);
+    prev_sibling.assign(num_nodes, NONE);
+    parent[root] = NONE;
+    depth[root] = 0;
+    potential[root] = 0;
+    big_M_potential[root] = 0;
+    for (size_t node = 0; node < num_constrains; ++node) {
+        parent[node] = opposite(pred[node], node);
+        link_child(parent[node], node);
+    }
+    for (size_t child = first_child[root]; child != NONE; child = next_sibling[child]) {
+        update_subtree(child);
+    }
+}
+
+
+/**
+ * @brief method to replace a tree arc by the entering arc, updating only the subtree that moves
+ *
+ * Removing the leaving arc detaches the subtree of its end farther from the root, which the entering
+ * arc joins back to the tree through its end inside the subtree. The tree path from that end up to
+ * the old root of the subtree is reversed, then depth and potentials are updated inside the subtree
+ * only: a pivot costs the length of the cycle plus the size of the subtree, not the number of nodes.
+ *
+ * @tparam T
+ * @param leaving_arc arc leaving the tree
+ * @param entering_arc arc entering the tree
+ */
+template<typename T>
+void NetworkSimplex<T>::update_tree(size_t leaving_arc, size_t entering_arc) {
+
+    // root of the subtree detached by the leaving arc
+    size_t out = (pred[arc_tail[leaving_arc]] == leaving_arc) ? arc_tail[leaving_arc] : arc_head[leaving_arc];
+    // end of the entering arc inside the subtree, i.e. the one below out
+    size_t joining = arc_tail[entering_arc];
+    size_t node = joining;
+    while (depth[node] > depth[out]) {
+        node = parent[node];
+    }
+    if (node != out) {
+        joining = arc_head[entering_arc];
+    }
+
+    // reversing the path from joining up to out: every node becomes the parent of its old parent
+    unlink_child(out);
+    size_t new_parent = opposite(entering_arc, joining);
+    size_t new_pred = entering_arc;
+    node = joining;
+    while (true) {
+        size_t old_parent = parent[node];
+        size_t old_pred = pred[node];
+        if (node != out) {
+            unlink_child(node);
+        }
+        parent[node] = new_parent;
+        pred[node] = new_pred;
+        link_child(new_parent, node);
+        if (node == out) {
+            break;
+        }
+        new_parent = node;
+        new_pred = old_pred;
+        node = old_parent;
+    }
+    update_subtree(joining);
+}
+
+
+/**
+ * @brief method to set depth and potentials of the nodes of a subtree from the parent of its root;
+ * potentials make the reduced cost of every tree arc null
+ *
+ * @tparam T
+ * @param node root of the subtree
+ */
+template<typename T>
+void NetworkSimplex<T>::update_subtree(size_t node) {
+
+    order.assign(1, node);
+    while (!order.empty()) {
+        size_t child = order.back();
+        order.pop_back();
+        size_t arc = pred[child];
+        size_t up = parent[child];
+        depth[child] = depth[up] + 1;
+        // reduced cost cost - potential[tail] + potential[head] of the arc is null
+        T big_M_cost = is_artificial(arc) ? 1 : 0;
+        if (arc_tail[arc] == child) {
+            potential[child] = potential[up] + arc_cost[arc];
+            big_M_potential[child] = big_M_potential[up] + big_M_cost;
+        } else {
+            potential[child] = potential[up] - arc_cost[arc];
+            big_M_potential[child] = big_M_potential[up] - big_M_cost;
+        }
+        for (size_t next = first_child[child]; next != NONE; next = next_sibling[next]) {
+            order.push_back(next);
+        }
+    }
+}
+
+
+/**
+ * @brief method to add a node to the children of another one
+ *
+ * @tparam T
+ * @param node new parent
+ * @param child node added, not a child of any node
+ */
+template<typename T>
+void NetworkSimplex<T>::link_child(size_t node, size_t child) {
+
+    prev_sibling[child] = NONE;
+    next_sibling[child] = first_child[node];
+    if (first_child[node] != NONE) {
+        prev_sibling[first_child[node]] = child;
+    }
+    first_child[node] = child;
+}
+
+
+/**
+ * @brief method to remove a node from the children of its parent
+ *
+ * @tparam T
+ * @param child node removed
+ */
+template<typename T>
+void NetworkSimplex<T>::unlink_child(size_t child) {
+
+    if (prev_sibling[child] != NONE) {
+        next_sibling[prev_sibling[child]] = next_sibling[child];
+    } else {
+        first_child[parent[child]] = next_sibling[child];
+    }
+    if (next_sibling[child] != NONE) {
+        prev_sibling[next_sibling[child]] = prev_sibling[child];
+    }
+}
+
+
+/**
+ * @brief method to identify the arc entering the spanning tree
+ *
+ * Arcs are scanned by blocks, starting after the block of the last entering arc, and the arc with
+ * the most negative reduced cost of the first block containing one enters the tree. Reduced costs
+ * are compared first by their M part, as in Tableau::find_pivot_column.
+ *
+ * @tparam T
+ * @param big_M_only true to consider only the costs of artificial variables
+ * @return 'size_t' index of the entering arc, NONE if the flow is optimal
+ */
+template<typename T>
+size_t NetworkSimplex<T>::find_entering_arc(bool big_M_only) {
+
+    size_t num_arcs = first_artificial;
+    if (num_arcs == 0) {
+        return NONE;
+    }
+    size_t block_size = std::max<size_t>(static_cast<size_t>(std::sqrt(static_cast<double>(num_arcs))), 10);
+
+    size_t entering_arc = NONE;
+    T min_big_M = 0;
+    T min_cost = 0;
+    size_t scanned = 0;
+    size_t arc = next_arc % num_arcs;
+    while (scanned < num_arcs) {
+        size_t block_end = std::min(scanned + block_size, num_arcs);
+        for (; scanned < block_end; ++scanned) {
+            size_t tail = arc_tail[arc];
+            size_t head = arc_head[arc];
+            T big_M = big_M_potential[head] - big_M_potential[tail];
+            T cost = big_M_only ? 0 : arc_cost[arc] - potential[tail] + potential[head];
+            if (std::abs(big_M) <= tolerance) {
+                big_M = 0;
+            }
+            bool improving = big_M < 0 || (big_M == 0 && cost < -cost_tolerance);
+            if (improving && (entering_arc == NONE || big_M < min_big_M || (big_M == min_big_M && cost < min_cost))) {
+                entering_arc = arc;
+                min_big_M = big_M;
+                min_cost = cost;
+            }
+            arc = (arc + 1 == num_arcs) ? 0 : arc + 1;
+        }
+        if (entering_arc != NONE) {
+            break;
+        }
+    }
+    next_arc = arc;
+    return entering_arc;
+}
+
+
+/**
+ * @brief method to identify the arc leaving the spanning tree
+ *
+ * Flow grows along the entering arc, from its tail to its head, and goes back to the tail through
+ * the tree: it decreases on the tree arcs of the cycle traversed against their direction, and the
+ * first of them to reach 0 leaves the tree. Ties are broken as in strongly feasible trees: the last
+ * blocking arc met going around the cycle from the node where the two tree paths join.
+ *
+ * @tparam T
+ * @param entering_arc index of the arc entering the tree
+ * @param delta flow pushed along the cycle
+ * @return 'size_t' index of the leaving arc, NONE if the flow can grow without limit
+ */
+template<typename T>
+size_t NetworkSimplex<T>::find_leaving_arc(size_t entering_arc, T& delta) const {
+
+    size_t first = arc_tail[entering_arc];
+    size_t second = arc_head[entering_arc];
+    // node where the tree paths from the two ends of the entering arc join
+    size_t u = first;
+    size_t v = second;
+    while (u != v) {
+        if (depth[u] >= depth[v]) {
+            u = parent[u];
+        } else {
+            v = parent[v];
+        }
+    }
+    size_t join = u;
+
+    size_t leaving_arc = NONE;
+    // path from the join node down to the tail: flow decreases on arcs pointing to the parent
+    for (size_t node = first; node != join; node = parent[node]) {
+        size_t arc = pred[node];
+        if (arc_tail[arc] == node && (leaving_arc == NONE || arc_flow[arc] < delta)) {
+            leaving_arc = arc;
+            delta = arc_flow[arc];
+        }
+    }
+    // path from the head up to the join node: flow decreases on arcs pointing to the child
+    for (size_t node = second; node != join; node = parent[node]) {
+        size_t arc = pred[node];
+        if (arc_head[arc] == node && (leaving_arc == NONE || arc_flow[arc] <= delta)) {
+            leaving_arc = arc;
+            delta = arc_flow[arc];
+        }
+    }
+    return leaving_arc;
+}
+
+
+/**
+ * @brief method to push flow along the cycle closed by the entering arc
+ *
+ * @tparam T
+ * @param entering_arc index of the arc entering the tree
+ * @param delta flow pushed along the cycle
+ */
+template<typename T>
+void NetworkSimplex<T>::push_flow(size_t entering_arc, const T& delta) {
+
+    if (delta == 0) {
+        return;
+    }
+    arc_flow[entering_arc] += delta;
+    size_t first = arc_tail[entering_arc];
+    size_t second = arc_head[entering_arc];
+    size_t u = first;
+    size_t v = second;
+    while (u != v) {
+        if (depth[u] >= depth[v]) {
+            // flow goes down from the parent to the tail
+            arc_flow[pred[u]] += (arc_tail[pred[u]] == u) ? -delta : delta;
+            u = parent[u];
+        } else {
+            // flow goes up from the head to the parent
+            arc_flow[pred[v]] += (arc_tail[pred[v]] == v) ? delta : -delta;
+            v = parent[v];
+        }
+    }
+}
+
+
+/**
+ * @brief method to check whether an artificial variable is still positive
+ *
+ * @tparam T
+ * @return true if the flow does not satisfy the constrains yet
+ */
+template<typename T>
+bool NetworkSimplex<T>::has_positive_artificial() const {
+
+    for (size_t arc = first_artificial; arc < arc_tail.size(); ++arc) {
+        if (arc_flow[arc] > flow_tolerance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief method to write decisional variables and z, as LinearConstrainSystem<T>::optimize does
+ *
+ * @tparam T
+ * @param solution vector where decisional variables and z are written
+ * @param c vector of objective function coefficients
+ */
+template<typename T>
+void NetworkSimplex<T>::get_solution(std::vector<T>& solution, const std::vector<T>& c) const {
+
+    solution.assign(arc_flow.begin(), arc_flow.begin() + num_variables);
+    T z = 0;
+    for (size_t j = 0; j < num_variables; ++j) {
+        z += c[j] * solution[j];
+    }
+    solution.emplace_back(z);
+}
+
+
+/**
+ * @brief method to get the dual value (shadow price) dz/db of every constrain from node potentials
+ *
+ * The potential of a node is the dual value of its row after scaling, with the root at 0.
+ *
+ * @tparam T
+ * @param duals vector where dual values are written
+ * @param type optimization type
+ */
+template<typename T>
+void NetworkSimplex<T>::get_duals(std::vector<T>& duals, const typename LinearConstrainSystem<T>::OptimizationType type) const {
+
+    // the network simplex always minimizes: results of a maximization have opposite sign
+    T sign = (type == LinearConstrainSystem<T>::OptimizationType::MAX) ? -1 : 1;
+    duals.resize(num_constrains);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        duals[row] = sign * row_scale[row] * potential[row];
+    }
+}
+
+#endif // __NETWORKSIMPLEX_HPP__
@@ -0,0 +1,736 @@
+#ifndef __RATIONAL_HPP__
+#define __RATIONAL_HPP__
+
+
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+
+/**
+ * @brief class for arbitrary precision integers, as sign and magnitude
+ *
+ * The magnitude is a vector of 32-bit limbs, the least significant first and without leading zero
+ * limbs: 0 is the empty vector and is never negative.
+ */
+class BigInteger {
+
+    std::vector<uint32_t> limbs;    //!< magnitude, least significant limb first
+    bool negative{false};           //!< sign
+
+  public:
+
+    // empty constructor, equal to 0
+    BigInteger() {}
+    // constructor from an integer
+    BigInteger(long long value);
+
+    /**
+     * @brief method to check whether the number is 0
+     */
+    inline bool is_zero() const { return limbs.empty(); }
+    /**
+     * @brief method to get the sign of the number: -1, 0 or 1
+     */
+    inline int sign() const { return limbs.empty() ? 0 : (negative ? -1 : 1); }
+
+    // method to get the number of bits of the magnitude
+    size_t bit_length() const;
+    // method to get the nearest double, up to the rounding of the last bit
+    double to_double() const;
+    // method to write the number in base 10
+    std::string to_string() const;
+
+    // method to compute quotient and remainder of a division rounding towards 0
+    static void divide(const BigInteger& a, const BigInteger& b, BigInteger& quotient, BigInteger& remainder);
+    // method to compute the greatest common divisor of the magnitudes
+    static BigInteger gcd(BigInteger a, BigInteger b);
+    // method to compare two numbers
+    static int compare(const BigInteger& a, const BigInteger& b);
+
+    BigInteger operator-() const;
+    BigInteger& operator+=(const BigInteger& other);
+    BigInteger& operator-=(const BigInteger& other);
+    BigInteger& operator<<=(size_t bits);
+    BigInteger& operator>>=(size_t bits);
+    friend BigInteger operator+(BigInteger a, const BigInteger& b) { return a += b; }
+    friend BigInteger operator-(BigInteger a, const BigInteger& b) { return a -= b; }
+    friend BigInteger operator*(const BigInteger& a, const BigInteger& b);
+    friend BigInteger operator/(const BigInteger& a, const BigInteger& b);
+    friend bool operator==(const BigInteger& a, const BigInteger& b) { return a.negative == b.negative && a.limbs == b.limbs; }
+    friend bool operator!=(const BigInteger& a, const BigInteger& b) { return !(a == b); }
+    friend bool operator<(const BigInteger& a, const BigInteger& b) { return compare(a, b) < 0; }
+
+  private:
+
+    // method to remove leading zero limbs
+    void trim();
+    // method to compare two magnitudes
+    static int compare_magnitude(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+    // method to add magnitude b to magnitude a
+    static void add_magnitude(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+    // method to subtract magnitude b from magnitude a, not smaller than b
+    static void subtract_magnitude(std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+    // method to divide magnitude u by magnitude v
+    static void divide_magnitude(const std::vector<uint32_t>& u, const std::vector<uint32_t>& v,
+                                 std::vector<uint32_t>& quotient, std::vector<uint32_t>& remainder);
+};
+
+
+
+/**
+ * @brief class for exact rational numbers, as a fraction of BigInteger in lowest terms with
+ * positive denominator
+ *
+ * Every double is a rational number, so doubles convert to Rational exactly.
+ */
+class Rational {
+
+    BigInteger num;         //!< numerator
+    BigInteger den{1};      //!< denominator, always positive
+
+  public:
+
+    // empty constructor, equal to 0
+    Rational() {}
+    /**
+     * @brief constructor from an integer
+     */
+    Rational(int value) : num(value) {}
+    /**
+     * @brief constructor from an integer
+     */
+    Rational(long long value) : num(value) {}
+    // constructor from the exact value of a finite double
+    explicit Rational(double value);
+    // constructor from numerator and denominator
+    Rational(const BigInteger& numerator, const BigInteger& denominator);
+
+    /**
+     * @brief method to get the numerator, whose sign is the sign of the number
+     */
+    inline const BigInteger& numerator() const { return num; }
+    /**
+     * @brief method to get the denominator, always positive
+     */
+    inline const BigInteger& denominator() const { return den; }
+    /**
+     * @brief method to check whether the number is 0
+     */
+    inline bool is_zero() const { return num.is_zero(); }
+    /**
+     * @brief method to get the sign of the number: -1, 0 or 1
+     */
+    inline int sign() const { return num.sign(); }
+
+    // method to get the nearest double, up to the rounding of the last bit
+    double to_double() const;
+    // method to write the number as numerator/denominator in base 10
+    std::string to_string() const;
+
+    Rational operator-() const;
+    Rational& operator+=(const Rational& other);
+    Rational& operator-=(const Rational& other);
+    Rational& operator*=(const Rational& other);
+    Rational& operator/=(const Rational& other);
+    friend Rational operator+(Rational a, const Rational& b) { return a += b; }
+    friend Rational operator-(Rational a, const Rational& b) { return a -= b; }
+    friend Rational operator*(Rational a, const Rational& b) { return a *= b; }
+    friend Rational operator/(Rational a, const Rational& b) { return a /= b; }
+    friend bool operator==(const Rational& a, const Rational& b) { return a.num == b.num && a.den == b.den; }
+    friend bool operator!=(const Rational& a, const Rational& b) { return !(a == b); }
+    friend bool operator<(const Rational& a, const Rational& b) { return (a - b).sign() < 0; }
+    friend bool operator>(const Rational& a, const Rational& b) { return b < a; }
+    friend bool operator<=(const Rational& a, const Rational& b) { return !(b < a); }
+    friend bool operator>=(const Rational& a, const Rational& b) { return !(a < b); }
+    friend std::ostream& operator<<(std::ostream& os, const Rational& value) { return os << value.to_string(); }
+
+  private:
+
+    // method to bring the fraction in lowest terms with positive denominator
+    void normalize();
+};
+
+
+/**
+ * @brief constructor from an integer
+ *
+ * @param value integer value
+ */
+inline BigInteger::BigInteger(long long value) {
+
+    negative = value < 0;
+    // magnitude computed in unsigned arithmetic, so that the smallest long long does not overflow
+    unsigned long long magnitude = negative ? 0ull - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+    while (magnitude != 0) {
+        limbs.push_back(static_cast<uint32_t>(magnitude));
+        magnitude >>= 32;
+    }
+}
+
+
+/**
+ * @brief method to remove leading zero limbs, 0 being never negative
+ */
+inline void BigInteger::trim() {
+
+    while (!limbs.empty() && limbs.back() == 0) {
+        limbs.pop_back();
+    }
+    if (limbs.empty()) {
+        negative = false;
+    }
+}
+
+
+/**
+ * @brief method to get the number of bits of the magnitude
+ *
+ * @return 'size_t' position of the highest bit set plus 1, 0 for 0
+ */
+inline size_t BigInteger::bit_length() const {
+
+    if (limbs.empty()) {
+        return 0;
+    }
+    size_t bits = 32 * (limbs.size() - 1);
+    for (uint32_t top = limbs.back(); top != 0; top >>= 1) {
+        ++bits;
+    }
+    return bits;
+}
+
+
+/**
+ * @brief method to get the nearest double, up to the rounding of the last bit: the three highest
+ * limbs are enough for the 53 bits of the mantissa
+ *
+ * @return 'double' value of the number, +-infinity if too large
+ */
+inline double BigInteger::to_double() const {
+
+    double value = 0;
+    size_t first = limbs.size() > 3 ? limbs.size() - 3 : 0;
+    for (size_t k = limbs.size(); k > first; --k) {
+        value = value * 4294967296.0 + limbs[k - 1];
+    }
+    value = std::ldexp(value, static_cast<int>(32 * first));
+    return negative ? -value : value;
+}
+
+
+/**
+ * @brief method to write the number in base 10
+ *
+ * @return 'std::string' decimal digits, with a leading '-' if negative
+ */
+inline std::string BigInteger::to_string() const {
+
+    if (limbs.empty()) {
+        return "0";
+    }
+    std::string digits;
+    std::vector<uint32_t> magnitude = limbs;
+    // dividing by 10^9, nine digits at a time
+    while (!magnitude.empty()) {
+        uint64_t remainder = 0;
+        for (size_t k = magnitude.size(); k > 0; --k) {
+            uint64_t current = (remainder << 32) | magnitude[k - 1];
+            magnitude[k - 1] = static_cast<uint32_t>(current / 1000000000);
+            remainder = current % 1000000000;
+        }
+        while (!magnitude.empty() && magnitude.back() == 0) {
+            magnitude.pop_back();
+        }
+        for (int digit = 0; digit < 9 && (!magnitude.empty() || remainder != 0); ++digit) {
+            digits.push_back(static_cast<char>('0' + remainder % 10));
+            remainder /= 10;
+        }
+    }
+    if (negative) {
+        digits.push_back('-');
+    }
+    return std::string(digits.rbegin(), digits.rend());
+}
+
+
+/**
+ * @brief method to compare two magnitudes
+ *
+ * @return 'int' -1, 0 or 1 as a is smaller, equal or greater than b
+ */
+inline int BigInteger::compare_magnitude(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+
+    if (a.size() != b.size()) {
+        return a.size() < b.size() ? -1 : 1;
+    }
+    for (size_t k = a.size(); k > 0; --k) {
+        if (a[k - 1] != b[k - 1]) {
+            return a[k - 1] < b[k - 1] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+
+/**
+ * @brief method to compare two numbers
+ *
+ * @return 'int' -1, 0 or 1 as a is smaller, equal or greater than b
+ */
+inline int BigInteger::compare(const BigInteger& a, const BigInteger& b) {
+
+    if (a.sign() != b.sign()) {
+        return a.sign() < b.sign() ? -1 : 1;
+    }
+    int result = compare_magnitude(a.limbs, b.limbs);
+    return a.negative ? -result : result;
+}
+
+
+/**
+ * @brief method to add magnitude b to magnitude a
+ */
+inline void BigInteger::add_magnitude(std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+
+    if (a.size() < b.size()) {
+        a.resize(b.size(), 0);
+    }
+    uint64_t carry = 0;
+    for (size_t k = 0; k < a.size(); ++k) {
+        uint64_t sum = carry + a[k] + (k < b.size() ? b[k] : 0);
+        a[k] = static_cast<uint32_t>(sum);
+        carry = sum >> 32;
+        if (carry == 0 && k >= b.size()) {
+            break;
+        }
+    }
+    if (carry != 0) {
+        a.push_back(static_cast<uint32_t>(carry));
+    }
+}
+
+
+/**
+ * @brief method to subtract magnitude b from magnitude a, not smaller than b; leading zero limbs
+ * are left to the caller
+ */
+inline void BigInteger::subtract_magnitude(std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+
+    int64_t borrow = 0;
+    for (size_t k = 0; k < a.size(); ++k) {
+        int64_t difference = static_cast<int64_t>(a[k]) - borrow - (k < b.size() ? b[k] : 0);
+        borrow = difference < 0 ? 1 : 0;
+        a[k] = static_cast<uint32_t>(difference + (borrow << 32));
+        if (borrow == 0 && k >= b.size()) {
+            break;
+        }
+    }
+}
+
+
+inline BigInteger BigInteger::operator-() const {
+
+    BigInteger result = *this;
+    result.negative = !result.negative && !result.limbs.empty();
+    return result;
+}
+
+
+inline BigInteger& BigInteger::operator+=(const BigInteger& other) {
+
+    if (negative == other.negative) {
+        add_magnitude(limbs, other.limbs);
+    } else if (compare_magnitude(limbs, other.limbs) >= 0) {
+        subtract_magnitude(limbs, other.limbs);
+    } else {
+        std::vector<uint32_t> magnitude = other.limbs;
+        subtract_magnitude(magnitude, limbs);
+        limbs.swap(magnitude);
+        negative = other.negative;
+    }
+    trim();
+    return *this;
+}
+
+
+inline BigInteger& BigInteger::operator-=(const BigInteger& other) {
+
+    return *this += -other;
+}
+
+
+inline BigInteger& BigInteger::operator<<=(size_t bits) {
+
+    if (limbs.empty() || bits == 0) {
+        return *this;
+    }
+    size_t shift = bits % 32;
+    if (shift != 0) {
+        uint32_t carry = 0;
+        for (auto& limb : limbs) {
+            uint32_t next = limb >> (32 - shift);
+            limb = (limb << shift) | carry;
+            carry = next;
+        }
+        if (carry != 0) {
+            limbs.push_back(carry);
+        }
+    }
+    limbs.insert(limbs.begin(), bits / 32, 0);
+    return *this;
+}
+
+
+inline BigInteger& BigInteger::operator>>=(size_t bits) {
+
+    size_t whole = bits / 32;
+    if (whole >= limbs.size()) {
+        limbs.clear();
+        negative = false;
+        return *this;
+    }
+    limbs.erase(limbs.begin(), limbs.begin() + whole);
+    size_t shift = bits % 32;
+    if (shift != 0) {
+        for (size_t k = 0; k < limbs.size(); ++k) {
+            uint32_t high = (k + 1 < limbs.size()) ? limbs[k + 1] << (32 - shift) : 0;
+            limbs[k] = (limbs[k] >> shift) | high;
+        }
+    }
+    trim();
+    return *this;
+}
+
+
+inline BigInteger operator*(const BigInteger& a, const BigInteger& b) {
+
+    BigInteger result;
+    if (a.limbs.empty() || b.limbs.empty()) {
+        return result;
+    }
+    result.limbs.assign(a.limbs.size() + b.limbs.size(), 0);
+    for (size_t i = 0; i < a.limbs.size(); ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < b.limbs.size(); ++j) {
+            uint64_t product = static_cast<uint64_t>(a.limbs[i]) * b.limbs[j] + result.limbs[i + j] + carry;
+            result.limbs[i + j] = static_cast<uint32_t>(product);
+            carry = product >> 32;
+        }
+        result.limbs[i + b.limbs.size()] = static_cast<uint32_t>(carry);
+    }
+    result.negative = a.negative != b.negative;
+    result.trim();
+    return result;
+}
+
+
+/**
+ * @brief method to divide magnitude u by magnitude v, not 0, with Knuth's algorithm D: every limb
+ * of the quotient is estimated from the two highest limbs of the remainder and corrected at most
+ * twice, after shifting v so that its highest bit is set
+ *
+ * @param u dividend
+ * @param v divisor
+ * @param quotient magnitude of the quotient, with leading zero limbs
+ * @param remainder magnitude of the remainder, with leading zero limbs
+ */
+inline void BigInteger::divide_magnitude(const std::vector<uint32_t>& u, const std::vector<uint32_t>& v,
+                                         std::vector<uint32_t>& quotient, std::vector<uint32_t>& remainder) {
+
+    const uint64_t base = 1ull << 32;
+    size_t m = u.size();
+    size_t n = v.size();
+    if (m < n) {
+        quotient.clear();
+        remainder = u;
+        return;
+    }
+    quotient.assign(m - n + 1, 0);
+    // single limb divisor: short division
+    if (n == 1) {
+        uint64_t current = 0;
+        for (size_t k = m; k > 0; --k) {
+            current = (current << 32) | u[k - 1];
+            quotient[k - 1] = static_cast<uint32_t>(current / v[0]);
+            current %= v[0];
+        }
+        remainder.assign(1, static_cast<uint32_t>(current));
+        return;
+    }
+
+    // normalizing, so that the highest limb of the divisor has its highest bit set
+    int shift = 0;
+    for (uint32_t top = v[n - 1]; (top & 0x80000000u) == 0; top <<= 1) {
+        ++shift;
+    }
+    std::vector<uint32_t> vn(n);
+    for (size_t k = n - 1; k > 0; --k) {
+        vn[k] = (v[k] << shift) | (shift != 0 ? v[k - 1] >> (32 - shift) : 0);
+    }
+    vn[0] = v[0] << shift;
+    std::vector<uint32_t> un(m + 1);
+    un[m] = shift != 0 ? u[m - 1] >> (32 - shift) : 0;
+    for (size_t k = m - 1; k > 0; --k) {
+        un[k] = (u[k] << shift) | (shift != 0 ? u[k - 1] >> (32 - shift) : 0);
+    }
+    un[0] = u[0] << shift;
+
+    for (size_t j = m - n + 1; j > 0; --j) {
+        size_t position = j - 1;
+        // estimating the quotient limb from the two highest limbs
+        uint64_t numerator = (static_cast<uint64_t>(un[position + n]) << 32) | un[position + n - 1];
+        uint64_t qhat = numerator / vn[n - 1];
+        uint64_t rhat = numerator % vn[n - 1];
+        while (qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[position + n - 2])) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= base) {
+                break;
+            }
+        }
+        // multiplying and subtracting
+        int64_t borrow = 0;
+        int64_t difference = 0;
+        for (size_t k = 0; k < n; ++k) {
+            uint64_t product = qhat * vn[k];
+            difference = static_cast<int64_t>(un[position + k]) - borrow - static_cast<int64_t>(product & 0xffffffffu);
+            un[position + k] = static_cast<uint32_t>(difference);
+            borrow = static_cast<int64_t>(product >> 32) - (difference >> 32);
+        }
+        difference = static_cast<int64_t>(un[position + n]) - borrow;
+        un[position + n] = static_cast<uint32_t>(difference);
+        quotient[position] = static_cast<uint32_t>(qhat);
+        // the estimate was one too large: adding the divisor back
+        if (difference < 0) {
+            --quotient[position];
+            uint64_t carry = 0;
+            for (size_t k = 0; k < n; ++k) {
+                uint64_t sum = static_cast<uint64_t>(un[position + k]) + vn[k] + carry;
+                un[position + k] = static_cast<uint32_t>(sum);
+                carry = sum >> 32;
+            }
+            un[position + n] += static_cast<uint32_t>(carry);
+        }
+    }
+
+    // unnormalizing the remainder
+    remainder.resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        remainder[k] = (un[k] >> shift) | (shift != 0 ? un[k + 1] << (32 - shift) : 0);
+    }
+}
+
+
+/**
+ * @brief method to compute quotient and remainder of a division rounding towards 0, as the integer
+ * division of C++: the remainder has the sign of a
+ *
+ * @param a dividend
+ * @param b divisor, std::domain_error is thrown if it is 0
+ * @param quotient quotient of the division
+ * @param remainder remainder of the division
+ */
+inline void BigInteger::divide(const BigInteger& a, const BigInteger& b, BigInteger& quotient, BigInteger& remainder) {
+
+    if (b.is_zero()) {
+        throw std::domain_error("Division by zero");
+    }
+    bool quotient_negative = a.negative != b.negative;
+    bool remainder_negative = a.negative;
+    divide_magnitude(a.limbs, b.limbs, quotient.limbs, remainder.limbs);
+    quotient.negative = quotient_negative;
+    remainder.negative = remainder_negative;
+    quotient.trim();
+    remainder.trim();
+}
+
+
+inline BigInteger operator/(const BigInteger& a, const BigInteger& b) {
+
+    BigInteger quotient, remainder;
+    BigInteger::divide(a, b, quotient, remainder);
+    return quotient;
+}
+
+
+/**
+ * @brief method to compute the greatest common divisor of the magnitudes, by Euclid's algorithm
+ *
+ * @return 'BigInteger' positive greatest common divisor, 0 if both are 0
+ */
+inline BigInteger BigInteger::gcd(BigInteger a, BigInteger b) {
+
+    a.negative = false;
+    b.negative = false;
+    BigInteger quotient, remainder;
+    while (!b.is_zero()) {
+        divide(a, b, quotient, remainder);
+        a.limbs.swap(b.limbs);
+        b.limbs.swap(remainder.limbs);
+    }
+    return a;
+}
+
+
+/**
+ * @brief constructor from the exact value of a finite double, mantissa * 2^exponent
+ *
+ * @param value finite double, std::domain_error is thrown for infinity and NaN
+ */
+inline Rational::Rational(double value) {
+
+    if (!std::isfinite(value)) {
+        throw std::domain_error("Only finite values are rational");
+    }
+    int exponent = 0;
+    double mantissa = std::frexp(value, &exponent);
+    // 53 bits of mantissa as an integer
+    num = BigInteger(static_cast<long long>(std::ldexp(mantissa, 53)));
+    exponent -= 53;
+    if (exponent >= 0) {
+        num <<= static_cast<size_t>(exponent);
+    } else {
+        den <<= static_cast<size_t>(-exponent);
+        normalize();
+    }
+}
+
+
+/**
+ * @brief constructor from numerator and denominator
+ *
+ * @param numerator numerator
+ * @param denominator denominator, std::domain_error is thrown if it is 0
+ */
+inline Rational::Rational(const BigInteger& numerator, const BigInteger& denominator) : num(numerator), den(denominator) {
+
+    if (den.is_zero()) {
+        throw std::domain_error("Division by zero");
+    }
+    normalize();
+}
+
+
+/**
+ * @brief method to bring the fraction in lowest terms with positive denominator
+ */
+inline void Rational::normalize() {
+
+    if (den.sign() < 0) {
+        num = -num;
+        den = -den;
+    }
+    if (num.is_zero()) {
+        den = BigInteger(1);
+        return;
+    }
+    BigInteger divisor = BigInteger::gcd(num, den);
+    if (divisor != BigInteger(1)) {
+        num = num / divisor;
+        den = den / divisor;
+    }
+}
+
+
+/**
+ * @brief method to get the nearest double, up to the rounding of the last bit: the quotient of
+ * numerator and denominator is computed with 64 bits, then scaled
+ *
+ * @return 'double' value of the number
+ */
+inline double Rational::to_double() const {
+
+    if (num.is_zero()) {
+        return 0;
+    }
+    // scaling the numerator so that the integer quotient has at least 64 bits
+    long long scale = 64 + static_cast<long long>(den.bit_length()) - static_cast<long long>(num.bit_length());
+    BigInteger scaled = num;
+    BigInteger divisor = den;
+    if (scale > 0) {
+        scaled <<= static_cast<size_t>(scale);
+    } else {
+        divisor <<= static_cast<size_t>(-scale);
+    }
+    return std::ldexp((scaled / divisor).to_double(), static_cast<int>(-scale));
+}
+
+
+/**
+ * @brief method to write the number as numerator/denominator in base 10
+ *
+ * @return 'std::string' the numerator only for integers
+ */
+inline std::string Rational::to_string() const {
+
+    if (den == BigInteger(1)) {
+        return num.to_string();
+    }
+    return num.to_string() + "/" + den.to_string();
+}
+
+
+inline Rational Rational::operator-() const {
+
+    Rational result = *this;
+    result.num = -result.num;
+    return result;
+}
+
+
+inline Rational& Rational::operator+=(const Rational& other) {
+
+    if (den == other.den) {
+        num += other.num;
+        // the common denominator may now share a factor with the numerator
+        if (den != BigInteger(1)) {
+            normalize();
+        }
+        return *this;
+    }
+    num = num * other.den + other.num * den;
+    den = den * other.den;
+    normalize();
+    return *this;
+}
+
+
+inline Rational& Rational::operator-=(const Rational& other) {
+
+    return *this += -other;
+}
+
+
+inline Rational& Rational::operator*=(const Rational& other) {
+
+    if (num.is_zero() || other.num.is_zero()) {
+        num = BigInteger();
+        den = BigInteger(1);
+        return *this;
+    }
+    num = num * other.num;
+    den = den * other.den;
+    if (den != BigInteger(1)) {
+        normalize();
+    }
+    return *this;
+}
+
+
+inline Rational& Rational::operator/=(const Rational& other) {
+
+    if (other.num.is_zero()) {
+        throw std::domain_error("Division by zero");
+    }
+    num = num * other.den;
+    den = den * other.num;
+    normalize();
+    return *this;
+}
+
+#endif // __RATIONAL_HPP__
@@ -0,0 +1,123 @@
+#ifndef __SIMPLEXCLIENT_HPP__
+#define __SIMPLEXCLIENT_HPP__
+
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SimplexProtocol.hpp"
+
+
+/**
+ * @brief class for a connection to simplex_server
+ *
+ * Requests can be sent one after the other without waiting for their responses, which come back
+ * as soon as they are solved, not necessarily in the same order: they are matched by id.
+ * Available on POSIX systems only, elsewhere the constructor throws std::runtime_error.
+ */
+class SimplexClient {
+
+    int socket{-1};                 //!< socket connected to the server
+    std::vector<char> message;      //!< buffer for the messages sent and received
+
+  public:
+
+    // constructor connecting to the server
+    SimplexClient(const std::string& path);
+    // destructor closing the connection
+    ~SimplexClient();
+    SimplexClient(const SimplexClient&) = delete;
+    SimplexClient& operator=(const SimplexClient&) = delete;
+
+    // method to send a request without waiting for its response
+    void send(const SimplexProtocol::Request& request);
+    // method to wait for the next response
+    void receive(SimplexProtocol::Response& response);
+    // method to send a request and wait for its response
+    void solve(const SimplexProtocol::Request& request, SimplexProtocol::Response& response);
+};
+
+
+/**
+ * @brief Constructor connecting to the server
+ *
+ * @param path path of the Unix domain socket the server listens on
+ */
+inline SimplexClient::SimplexClient(const std::string& path) {
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path too long");
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket == -1) {
+        throw std::runtime_error("Cannot create socket");
+    }
+    if (::connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        ::close(socket);
+        throw std::runtime_error("Cannot connect to " + path);
+    }
+    #else
+    (void)path;
+    throw std::runtime_error("Unix domain sockets are not supported on this platform");
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+
+/**
+ * @brief Destructor closing the connection
+ */
+inline SimplexClient::~SimplexClient() {
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    if (socket != -1) {
+        ::close(socket);
+    }
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+
+/**
+ * @brief method to send a request without waiting for its response
+ *
+ * @param request request to be solved by the server
+ */
+inline void SimplexClient::send(const SimplexProtocol::Request& request) {
+
+    SimplexProtocol::encode(request, message);
+    SimplexProtocol::write_frame(socket, message);
+}
+
+
+/**
+ * @brief method to wait for the next response of the server
+ *
+ * @param response response where the result is written, std::runtime_error is thrown if the
+ * connection has been closed
+ */
+inline void SimplexClient::receive(SimplexProtocol::Response& response) {
+
+    if (!SimplexProtocol::read_frame(socket, message)) {
+        throw std::runtime_error("Connection closed by the server");
+    }
+    SimplexProtocol::decode(message, response);
+}
+
+
+/**
+ * @brief method to send a request and wait for its response, with no other request pending
+ *
+ * @param request request to be solved by the server
+ * @param response response where the result is written
+ */
+inline void SimplexClient::solve(const SimplexProtocol::Request& request, SimplexProtocol::Response& response) {
+
+    send(request);
+    receive(response);
+}
+
+#endif // __SIMPLEXCLIENT_HPP__
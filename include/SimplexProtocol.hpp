@@ -0,0 +1,348 @@
+#ifndef __SIMPLEXPROTOCOL_HPP__
+#define __SIMPLEXPROTOCOL_HPP__
+
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define SIMPLEX_HAS_UNIX_SOCKETS
+#endif
+
+#include "LinearConstrainSystem.hpp"
+
+
+/**
+ * @brief binary messages exchanged by simplex_server and SimplexClient over a Unix domain socket
+ *
+ * Both ends run on the same host, so numbers are written in the native byte order. Every message
+ * is a frame: its size in bytes as uint32_t, then the message, starting with MAGIC.
+ *
+ * Request: MAGIC, id (uint64_t), optimization type (uint8_t, 0 MIN, 1 MAX), number of constrains and
+ * of variables (uint32_t), every constrain as type (uint8_t, 0 EQ, 1 LE, 2 GE), constant term
+ * (double), number of nonzero coefficients (uint32_t) and (index uint32_t, value double) pairs,
+ * then the objective function coefficients (double).
+ *
+ * Response: MAGIC, id of the request, status (uint8_t, as SolutionType, ERROR for malformed
+ * requests), number of values (uint32_t) and the values: decisional variables and z for bounded
+ * problems, the bytes of the error message for errors.
+ */
+namespace SimplexProtocol {
+
+    typedef LinearConstrainSystem<double> System;
+
+    const uint32_t MAGIC = 0x534d5031;              //!< "SMP1", protocol version 1
+    const uint32_t MAX_FRAME_SIZE = 1u << 30;       //!< larger frames are rejected
+    const uint64_t MAX_COEFFICIENTS = 1ull << 27;   //!< requests with more constrain coefficients, nonzero or not, are rejected
+    const uint8_t ERROR = 3;                        //!< status of a request that could not be solved
+    #ifdef MSG_NOSIGNAL
+    const int SEND_FLAGS = MSG_NOSIGNAL;            //!< a closed connection is reported as an error instead of SIGPIPE
+    #else
+    const int SEND_FLAGS = 0;
+    #endif // MSG_NOSIGNAL
+
+    /**
+     * @brief struct representing an optimization requested to the server
+    */
+    struct Request {
+        uint64_t id{0};                                 //!< chosen by the client, sent back with the response
+        System::OptimizationType type{System::OptimizationType::MAX};  //!< optimization type
+        size_t num_variables{0};                        //!< number of decisional variables
+        std::vector<System::Constrain> constrains;      //!< constrains of the system
+        std::vector<double> c;                          //!< objective function coefficients
+    };
+
+    /**
+     * @brief struct representing the result of a request
+    */
+    struct Response {
+        uint64_t id{0};                     //!< id of the request
+        uint8_t status{ERROR};              //!< SolutionType of the result, or ERROR
+        std::vector<double> solution;       //!< decisional variables and z, as written by optimize
+        std::string error;                  //!< error message when status is ERROR
+    };
+
+    /**
+     * @brief method to append a value to a message
+     */
+    template<typename V>
+    inline void put(std::vector<char>& message, const V& value) {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        message.insert(message.end(), bytes, bytes + sizeof(V));
+    }
+
+    /**
+     * @brief method to read a value from a message at position offset, which is moved past it
+     */
+    template<typename V>
+    inline V get(const std::vector<char>& message, size_t& offset) {
+        if (message.size() - offset < sizeof(V)) {
+            throw std::runtime_error("Truncated message");
+        }
+        V value;
+        std::memcpy(&value, message.data() + offset, sizeof(V));
+        offset += sizeof(V);
+        return value;
+    }
+
+    // method to write a request in a message
+    void encode(const Request& request, std::vector<char>& message);
+    // method to read a request from a message
+    void decode(const std::vector<char>& message, Request& request);
+    // method to write a response in a message
+    void encode(const Response& response, std::vector<char>& message);
+    // method to read a response from a message
+    void decode(const std::vector<char>& message, Response& response);
+    // method to send a message as a frame
+    void write_frame(int socket, const std::vector<char>& message);
+    // method to receive the message of a frame
+    bool read_frame(int socket, std::vector<char>& message);
+}
+
+
+/**
+ * @brief method to write a request in a message, keeping only nonzero coefficients of constrains
+ *
+ * @param request request to be written
+ * @param message buffer where the message is written
+ */
+inline void SimplexProtocol::encode(const Request& request, std::vector<char>& message) {
+
+    message.clear();
+    put(message, MAGIC);
+    put(message, request.id);
+    put(message, static_cast<uint8_t>(request.type == System::OptimizationType::MAX ? 1 : 0));
+    put(message, static_cast<uint32_t>(request.constrains.size()));
+    put(message, static_cast<uint32_t>(request.num_variables));
+    if (static_cast<uint64_t>(request.constrains.size()) * request.num_variables > MAX_COEFFICIENTS) {
+        throw std::invalid_argument("Too many coefficients");
+    }
+    for (const auto& constrain : request.constrains) {
+        if (constrain.a.size() != request.num_variables) {
+            throw std::invalid_argument("Wrong number of variables in constrain");
+        }
+        put(message, static_cast<uint8_t>(constrain.type));
+        put(message, constrain.b);
+        uint32_t nonzeros = 0;
+        for (const auto& value : constrain.a) {
+            nonzeros += (value != 0);
+        }
+        put(message, nonzeros);
+        for (size_t j = 0; j < constrain.a.size(); ++j) {
+            if (constrain.a[j] != 0) {
+                put(message, static_cast<uint32_t>(j));
+                put(message, constrain.a[j]);
+            }
+        }
+    }
+    if (request.c.size() != request.num_variables) {
+        throw std::invalid_argument("Wrong number of variables in objective function");
+    }
+    for (const auto& value : request.c) {
+        put(message, value);
+    }
+}
+
+
+/**
+ * @brief method to read a request from a message
+ *
+ * The vectors of request are reused, so that decoding requests of the same size does not allocate.
+ *
+ * @param message received message
+ * @param request request where the message is read, std::runtime_error is thrown if it is malformed
+ */
+inline void SimplexProtocol::decode(const std::vector<char>& message, Request& request) {
+
+    size_t offset = 0;
+    if (get<uint32_t>(message, offset) != MAGIC) {
+        throw std::runtime_error("Unknown protocol");
+    }
+    request.id = get<uint64_t>(message, offset);
+    request.type = get<uint8_t>(message, offset) == 1 ? System::OptimizationType::MAX : System::OptimizationType::MIN;
+    uint32_t num_constrains = get<uint32_t>(message, offset);
+    request.num_variables = get<uint32_t>(message, offset);
+    // every constrain takes at least 13 bytes and every objective function coefficient 8:
+    // counts larger than the message are malformed
+    if (static_cast<uint64_t>(num_constrains) * 13 + static_cast<uint64_t>(request.num_variables) * sizeof(double) > message.size() - offset) {
+        throw std::runtime_error("Truncated message");
+    }
+    // constrains are expanded to num_variables coefficients each, also when sent almost empty
+    if (static_cast<uint64_t>(num_constrains) * request.num_variables > MAX_COEFFICIENTS) {
+        throw std::runtime_error("Too many coefficients");
+    }
+    request.constrains.resize(num_constrains);
+    for (auto& constrain : request.constrains) {
+        uint8_t type = get<uint8_t>(message, offset);
+        if (type > 2) {
+            throw std::runtime_error("Unknown constrain type");
+        }
+        constrain.type = static_cast<System::ConstrainType>(type);
+        constrain.b = get<double>(message, offset);
+        constrain.a.assign(request.num_variables, 0);
+        uint32_t nonzeros = get<uint32_t>(message, offset);
+        for (uint32_t k = 0; k < nonzeros; ++k) {
+            uint32_t index = get<uint32_t>(message, offset);
+            if (index >= request.num_variables) {
+                throw std::runtime_error("Variable index out of range");
+            }
+            constrain.a[index] = get<double>(message, offset);
+        }
+    }
+    if ((message.size() - offset) / sizeof(double) < request.num_variables) {
+        throw std::runtime_error("Truncated message");
+    }
+    request.c.resize(request.num_variables);
+    for (auto& value : request.c) {
+        value = get<double>(message, offset);
+    }
+}
+
+
+/**
+ * @brief method to write a response in a message
+ *
+ * @param response response to be written
+ * @param message buffer where the message is written
+ */
+inline void SimplexProtocol::encode(const Response& response, std::vector<char>& message) {
+
+    message.clear();
+    put(message, MAGIC);
+    put(message, response.id);
+    put(message, response.status);
+    if (response.status == ERROR) {
+        put(message, static_cast<uint32_t>(response.error.size()));
+        message.insert(message.end(), response.error.begin(), response.error.end());
+    } else {
+        put(message, static_cast<uint32_t>(response.solution.size()));
+        for (const auto& value : response.solution) {
+            put(message, value);
+        }
+    }
+}
+
+
+/**
+ * @brief method to read a response from a message
+ *
+ * @param message received message
+ * @param response response where the message is read, std::runtime_error is thrown if it is malformed
+ */
+inline void SimplexProtocol::decode(const std::vector<char>& message, Response& response) {
+
+    size_t offset = 0;
+    if (get<uint32_t>(message, offset) != MAGIC) {
+        throw std::runtime_error("Unknown protocol");
+    }
+    response.id = get<uint64_t>(message, offset);
+    response.status = get<uint8_t>(message, offset);
+    uint32_t size = get<uint32_t>(message, offset);
+    if (response.status == ERROR) {
+        if (message.size() - offset < size) {
+            throw std::runtime_error("Truncated message");
+        }
+        response.error.assign(message.data() + offset, size);
+        response.solution.clear();
+    } else {
+        if ((message.size() - offset) / sizeof(double) < size) {
+            throw std::runtime_error("Truncated message");
+        }
+        response.solution.resize(size);
+        for (auto& value : response.solution) {
+            value = get<double>(message, offset);
+        }
+        response.error.clear();
+    }
+}
+
+
+/**
+ * @brief method to send a message as a frame, retrying partial and interrupted writes
+ *
+ * @param socket connected socket
+ * @param message message to be sent, std::runtime_error is thrown if the connection fails
+ */
+inline void SimplexProtocol::write_frame(int socket, const std::vector<char>& message) {
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    uint32_t size = static_cast<uint32_t>(message.size());
+    char header[sizeof(size)];
+    std::memcpy(header, &size, sizeof(size));
+    const char* parts[2] = {header, message.data()};
+    size_t sizes[2] = {sizeof(size), message.size()};
+    for (size_t part = 0; part < 2; ++part) {
+        size_t written = 0;
+        while (written < sizes[part]) {
+            ssize_t result = ::send(socket, parts[part] + written, sizes[part] - written, SEND_FLAGS);
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                throw std::runtime_error("Connection closed");
+            }
+            written += static_cast<size_t>(result);
+        }
+    }
+    #else
+    (void)socket;
+    (void)message;
+    throw std::runtime_error("Unix domain sockets are not supported on this platform");
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+
+/**
+ * @brief method to receive the message of a frame, retrying partial and interrupted reads
+ *
+ * @param socket connected socket
+ * @param message buffer where the message is written
+ * @return true if a message has been received, false if the connection has been closed between
+ * two frames; std::runtime_error is thrown if it is closed inside a frame
+ */
+inline bool SimplexProtocol::read_frame(int socket, std::vector<char>& message) {
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    uint32_t size = 0;
+    char header[sizeof(size)];
+    for (size_t part = 0; part < 2; ++part) {
+        char* data = (part == 0) ? header : message.data();
+        size_t expected = (part == 0) ? sizeof(size) : size;
+        size_t received = 0;
+        while (received < expected) {
+            ssize_t result = ::read(socket, data + received, expected - received);
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result == 0 && part == 0 && received == 0) {
+                return false;
+            }
+            if (result <= 0) {
+                throw std::runtime_error("Connection closed inside a message");
+            }
+            received += static_cast<size_t>(result);
+        }
+        if (part == 0) {
+            std::memcpy(&size, header, sizeof(size));
+            if (size > MAX_FRAME_SIZE) {
+                throw std::runtime_error("Message too large");
+            }
+            message.resize(size);
+        }
+    }
+    return true;
+    #else
+    (void)socket;
+    (void)message;
+    throw std::runtime_error("Unix domain sockets are not supported on this platform");
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+#endif // __SIMPLEXPROTOCOL_HPP__
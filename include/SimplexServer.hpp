@@ -0,0 +1,414 @@
+#ifndef __SIMPLEXSERVER_HPP__
+#define __SIMPLEXSERVER_HPP__
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SimplexProtocol.hpp"
+
+
+/**
+ * @brief class for a solver daemon listening on a Unix domain socket
+ *
+ * Every connection has a thread reading its requests, which are queued as they arrive. A pool of
+ * workers takes them from the queue in batches of up to batch_size: a batch is decoded, ordered by
+ * size and solved on a LinearConstrainSystem kept by the worker, so that consecutive problems of the
+ * same shape are loaded with set_constrain and reuse its memory. Workers share the process-wide
+ * BasisCache, so that resubmitted models start from their last optimal base. Every response is
+ * written to its connection as soon as it is ready, so responses of a connection may come back out
+ * of order.
+ * Available on POSIX systems only, elsewhere the constructor throws std::runtime_error.
+ */
+class SimplexServer {
+
+    /**
+     * @brief struct representing a client connection, closed when its reader and all its requests are done
+    */
+    struct Connection {
+        int socket;                     //!< connected socket
+        std::mutex write_mutex;         //!< responses are written by several workers
+        std::atomic<bool> closed{false};    //!< flag set when the client has closed the connection
+        // constructor taking ownership of socket
+        Connection(int socket) : socket(socket) {}
+        // destructor closing the socket
+        ~Connection();
+    };
+
+    /**
+     * @brief struct representing a request waiting in the queue
+    */
+    struct Job {
+        std::shared_ptr<Connection> connection;    //!< connection the response goes to
+        std::vector<char> message;                 //!< encoded request
+    };
+
+    /**
+     * @brief struct collecting the buffers reused by a worker
+    */
+    struct Workspace {
+        std::vector<Job> batch;                                         //!< jobs taken from the queue at once
+        std::vector<SimplexProtocol::Request> requests;                 //!< decoded requests of the batch
+        std::vector<SimplexProtocol::Response> responses;               //!< responses of the batch
+        std::vector<size_t> order;                                      //!< batch positions in order of problem size
+        SimplexProtocol::System system;                                 //!< system the requests are solved on
+        std::vector<SimplexProtocol::System::ConstrainType> types;      //!< constrain types loaded in system
+        size_t num_variables{0};                                        //!< number of variables loaded in system
+        std::vector<char> message;                                      //!< buffer for encoded responses
+    };
+
+    std::string path;                   //!< path of the socket
+    size_t num_workers;                 //!< number of threads solving requests
+    size_t batch_size;                  //!< largest number of requests taken from the queue at once
+    int listener{-1};                   //!< listening socket
+    std::deque<Job> queue;              //!< requests waiting for a worker
+    std::mutex queue_mutex;             //!< mutex protecting queue and stopping
+    std::condition_variable queue_ready;    //!< workers wait on it for requests
+    bool stopping{false};               //!< flag set by stop
+    std::vector<std::thread> workers;   //!< threads solving requests
+    std::list<std::pair<std::thread, std::shared_ptr<Connection>>> readers;   //!< threads reading requests of every connection
+    std::mutex readers_mutex;           //!< mutex protecting readers
+
+    // method reading requests of a connection until it is closed
+    void read_requests(std::shared_ptr<Connection> connection);
+    // method run by every worker
+    void work();
+    // method to solve a batch of requests
+    void solve_batch(Workspace& workspace);
+    // method to solve a request
+    void solve(const SimplexProtocol::Request& request, SimplexProtocol::Response& response, Workspace& workspace);
+    // method to join readers of closed connections
+    void join_closed_readers();
+
+    /**
+     * @brief method to check whether stop has been called
+     */
+    inline bool is_stopping() {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        return stopping;
+    }
+
+  public:
+
+    // constructor creating the socket
+    SimplexServer(const std::string& path, size_t num_workers = std::max(1u, std::thread::hardware_concurrency()), size_t batch_size = 64);
+    // destructor stopping the server
+    ~SimplexServer();
+    SimplexServer(const SimplexServer&) = delete;
+    SimplexServer& operator=(const SimplexServer&) = delete;
+
+    // method to accept connections until stop is called
+    void run();
+    // method to stop the server from another thread
+    void stop();
+};
+
+
+/**
+ * @brief Destructor closing the socket
+ */
+inline SimplexServer::Connection::~Connection() {
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    ::close(socket);
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+
+/**
+ * @brief Constructor creating the socket and starting the workers
+ *
+ * A file left at path by a previous server is removed.
+ *
+ * @param path path of the Unix domain socket
+ * @param num_workers number of threads solving requests
+ * @param batch_size largest number of requests a worker takes from the queue at once
+ */
+inline SimplexServer::SimplexServer(const std::string& path, size_t num_workers, size_t batch_size)
+    : path(path), num_workers(std::max<size_t>(num_workers, 1)), batch_size(std::max<size_t>(batch_size, 1)) {
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path too long");
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener == -1) {
+        throw std::runtime_error("Cannot create socket");
+    }
+    ::unlink(path.c_str());
+    if (::bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, SOMAXCONN) != 0) {
+        ::close(listener);
+        throw std::runtime_error("Cannot listen on " + path);
+    }
+    for (size_t t = 0; t < this->num_workers; ++t) {
+        workers.emplace_back(&SimplexServer::work, this);
+    }
+    #else
+    throw std::runtime_error("Unix domain sockets are not supported on this platform");
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+
+/**
+ * @brief Destructor stopping the server and removing the socket
+ */
+inline SimplexServer::~SimplexServer() {
+
+    stop();
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    ::close(listener);
+    ::unlink(path.c_str());
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+
+/**
+ * @brief method to accept connections until stop is called, starting a reader thread for each
+ */
+inline void SimplexServer::run() {
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    while (true) {
+        int socket = ::accept(listener, nullptr, nullptr);
+        if (socket == -1) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            // the listener has been shut down by stop
+            break;
+        }
+        join_closed_readers();
+        std::lock_guard<std::mutex> lock(readers_mutex);
+        // stop may have joined the readers already
+        if (is_stopping()) {
+            ::close(socket);
+            break;
+        }
+        std::shared_ptr<Connection> connection = std::make_shared<Connection>(socket);
+        readers.emplace_back(std::thread(&SimplexServer::read_requests, this, connection), connection);
+    }
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+}
+
+
+/**
+ * @brief method to stop the server: run returns, connections are shut down, requests still in
+ * the queue are dropped and threads are joined
+ */
+inline void SimplexServer::stop() {
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (stopping) {
+            return;
+        }
+        stopping = true;
+        queue.clear();
+    }
+    queue_ready.notify_all();
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    ::shutdown(listener, SHUT_RDWR);
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::lock_guard<std::mutex> lock(readers_mutex);
+    for (auto& reader : readers) {
+        #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+        ::shutdown(reader.second->socket, SHUT_RDWR);
+        #endif // SIMPLEX_HAS_UNIX_SOCKETS
+        reader.first.join();
+    }
+    readers.clear();
+}
+
+
+/**
+ * @brief method to join the reader threads of connections closed by their clients
+ */
+inline void SimplexServer::join_closed_readers() {
+
+    std::lock_guard<std::mutex> lock(readers_mutex);
+    for (auto reader = readers.begin(); reader != readers.end();) {
+        if (reader->second->closed) {
+            reader->first.join();
+            reader = readers.erase(reader);
+        } else {
+            ++reader;
+        }
+    }
+}
+
+
+/**
+ * @brief method reading requests of a connection and queuing them, until the connection is closed
+ *
+ * @param connection connection to read from
+ */
+inline void SimplexServer::read_requests(std::shared_ptr<Connection> connection) {
+
+    try {
+        Job job;
+        while (SimplexProtocol::read_frame(connection->socket, job.message)) {
+            job.connection = connection;
+            {
+                std::lock_guard<std::mutex> lock(queue_mutex);
+                if (stopping) {
+                    break;
+                }
+                queue.push_back(std::move(job));
+            }
+            queue_ready.notify_one();
+            job = Job();
+        }
+    } catch (const std::exception&) {
+        // a broken frame ends the connection: the stream can not be resynchronized
+    }
+    connection->closed = true;
+}
+
+
+/**
+ * @brief method run by every worker: taking batches of requests from the queue and solving them
+ */
+inline void SimplexServer::work() {
+
+    Workspace workspace;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_ready.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (stopping) {
+                return;
+            }
+            workspace.batch.clear();
+            while (!queue.empty() && workspace.batch.size() < batch_size) {
+                workspace.batch.push_back(std::move(queue.front()));
+                queue.pop_front();
+            }
+        }
+        solve_batch(workspace);
+    }
+}
+
+
+/**
+ * @brief method to solve a batch of requests, in order of size so that problems of the same shape
+ * are solved one after the other on the same system, and to send their responses
+ *
+ * @param workspace buffers of the worker
+ */
+inline void SimplexServer::solve_batch(Workspace& workspace) {
+
+    size_t size = workspace.batch.size();
+    workspace.requests.resize(std::max(workspace.requests.size(), size));
+    workspace.responses.resize(std::max(workspace.responses.size(), size));
+    workspace.order.resize(size);
+    for (size_t k = 0; k < size; ++k) {
+        workspace.order[k] = k;
+        SimplexProtocol::Response& response = workspace.responses[k];
+        try {
+            SimplexProtocol::decode(workspace.batch[k].message, workspace.requests[k]);
+            response.id = workspace.requests[k].id;
+            // written by solve
+            response.status = static_cast<uint8_t>(SimplexProtocol::System::SolutionType::BOUNDED);
+        } catch (const std::exception& error) {
+            // the id is read if the message is long enough
+            response.id = 0;
+            if (workspace.batch[k].message.size() >= sizeof(uint32_t) + sizeof(uint64_t)) {
+                std::memcpy(&response.id, workspace.batch[k].message.data() + sizeof(uint32_t), sizeof(uint64_t));
+            }
+            response.status = SimplexProtocol::ERROR;
+            response.error = error.what();
+        }
+    }
+    std::stable_sort(workspace.order.begin(), workspace.order.end(), [&workspace](size_t lhs, size_t rhs) {
+        const SimplexProtocol::Request& left = workspace.requests[lhs];
+        const SimplexProtocol::Request& right = workspace.requests[rhs];
+        return left.constrains.size() < right.constrains.size() ||
+               (left.constrains.size() == right.constrains.size() && left.num_variables < right.num_variables);
+    });
+
+    for (size_t k : workspace.order) {
+        SimplexProtocol::Response& response = workspace.responses[k];
+        if (response.status != SimplexProtocol::ERROR) {
+            solve(workspace.requests[k], response, workspace);
+        }
+        Connection& connection = *workspace.batch[k].connection;
+        SimplexProtocol::encode(response, workspace.message);
+        try {
+            std::lock_guard<std::mutex> lock(connection.write_mutex);
+            SimplexProtocol::write_frame(connection.socket, workspace.message);
+        } catch (const std::exception&) {
+            // the client has gone away, its response is dropped
+        }
+    }
+    // connections are released as soon as their requests are answered
+    workspace.batch.clear();
+}
+
+
+/**
+ * @brief method to solve a request on the system of the worker: a system with the same number of
+ * variables and the same constrain types is reloaded in place, otherwise a new one is built
+ *
+ * @param request request to be solved
+ * @param response response where the result is written
+ * @param workspace buffers of the worker
+ */
+inline void SimplexServer::solve(const SimplexProtocol::Request& request, SimplexProtocol::Response& response, Workspace& workspace) {
+
+    typedef SimplexProtocol::System System;
+    try {
+        if (request.constrains.empty()) {
+            throw std::invalid_argument("The constrain system is empty");
+        }
+        bool same_shape = request.num_variables == workspace.num_variables && request.constrains.size() == workspace.types.size();
+        for (size_t i = 0; i < request.constrains.size() && same_shape; ++i) {
+            same_shape = request.constrains[i].type == workspace.types[i];
+        }
+        if (same_shape) {
+            for (size_t i = 0; i < request.constrains.size(); ++i) {
+                const System::Constrain& constrain = request.constrains[i];
+                workspace.system.set_constrain(i, constrain.a, constrain.b, constrain.type);
+            }
+        } else {
+            // the shape is recorded only once the system is fully loaded
+            workspace.types.clear();
+            workspace.system = System();
+            // models resubmitted to any worker start from the optimal base of their last solve
+            workspace.system.set_basis_cache(BasisCache<double>::global());
+            for (const auto& constrain : request.constrains) {
+                workspace.system.add_constrain(constrain.a, constrain.b, constrain.type);
+            }
+            workspace.num_variables = request.num_variables;
+            for (const auto& constrain : request.constrains) {
+                workspace.types.push_back(constrain.type);
+            }
+        }
+        response.status = static_cast<uint8_t>(workspace.system.optimize(response.solution, request.c, request.type));
+    } catch (const InfeasibleSystemError&) {
+        response.status = static_cast<uint8_t>(System::SolutionType::INFEASIBLE);
+    } catch (const std::exception& error) {
+        // invalid requests and failures of the solver, e.g. of memory
+        response.status = SimplexProtocol::ERROR;
+        response.error = error.what();
+    }
+    if (response.status != static_cast<uint8_t>(System::SolutionType::BOUNDED)) {
+        response.solution.clear();
+    }
+}
+
+#endif // __SIMPLEXSERVER_HPP__
@@ -3,9 +3,16 @@
 
 
 #include <algorithm>
+#include <exception>
 #include <iostream>
+#include <thread>
 #include <vector>
 #include <limits>
+#include <memory>
+#include <random>
+
+#include "MappedStorage.hpp"
+#include "WorkerPool.hpp"
 
 
 template<typename T>
@@ -21,49 +28,112 @@ struct LinearConstrainSystem;
 template<typename T>
 class Tableau {
     
+    typedef std::vector<T, MappedAllocator<T>> Row;    //!< tableau row, on the heap or in a scratch file
+
     // members of the tableau for saving its data
 
-    std::vector<std::vector<T>> tableau;    //!< tableau matrix
+    std::vector<Row> tableau;               //!< tableau matrix
+    MappedAllocator<T> row_allocator;       //!< allocator of new rows, on the heap unless a scratch file is set
     std::vector<size_t> base;               //!< vector for base variable index
+    std::vector<size_t> additional_var_offsets; //!< first additional variable column of every row: slack or artificial variable in the starting base, then surplus variable for GE rows
     size_t num_variables{0};                //!< number of variables
     size_t num_constrains{0};               //!< number of constrains
     size_t slack_variables{0};              //!< number of slack variables
     size_t surplus_variables{0};            //!< number of surplus variables
     size_t artificial_variables{0};         //!< number of artificial variables
-    double BIG_M = 1e9;                     //!< defining Big_M with a very large value
+    T tolerance = std::numeric_limits<T>::epsilon() * 1024; //!< values whose magnitude is below tolerance are treated as 0
+    T cost_tolerance = tolerance;           //!< tolerance of real parts of reduced costs, scaled by add_objFunc_tableau
+    T big_M_tolerance = tolerance;          //!< tolerance of M parts of reduced costs, scaled by add_objFunc_tableau
     
     std::vector<std::pair<size_t, size_t>> artificial_var_indices;  //!< indexes (i,j) for position of artificial variables inside tableau
 
+    size_t parallel_rows_threshold = 20000;     //!< number of constrains from which create_initial_tableau writes rows with several threads
+    double sparse_pivot_threshold = 0.7;        //!< fraction of nonzero elements in pivot row above which pivot updates whole rows
+    std::vector<size_t> pivot_row_nonzeros;     //!< buffer for the columns with a nonzero element in pivot row
+    std::vector<size_t> pivot_column_nonzeros;  //!< buffer for the rows with a nonzero element in pivot column
+    size_t parallel_scan_threshold = 1 << 20;   //!< number of elements above which pricing and ratio test scan with several threads
+    mutable std::unique_ptr<WorkerPool> scan_pool;  //!< threads of the parallel scans, started by the first one and not copied
+    mutable std::vector<size_t> scan_block_min; //!< buffer for the position of the minimum of every block of a parallel scan
+    std::vector<T> entering_column;             //!< buffer for a contiguous copy of the constrain rows of pivot column
+    std::vector<T> scan_values;                 //!< buffer for the reduced costs and ratios scanned by the minimum search
+    std::vector<T> variable_values;             //!< buffer for the value of every variable in the basic solution
+    std::vector<size_t> reinvert_base;          //!< buffer for the base restored by reinvert
+    std::vector<bool> reinvert_columns;         //!< buffer flagging the columns of the base restored by reinvert
+    std::vector<bool> reinvert_rows;            //!< buffer flagging the rows already holding a restored base variable
+    std::vector<size_t> crash_counts;           //!< buffer for the nonzero elements of every decisional variable column
+    std::vector<size_t> crash_order;            //!< buffer for decisional variables in order of nonzero elements
+    std::vector<char> crash_in_base;            //!< buffer for decisional variables moved into the base by crash_basis
+    typename LinearConstrainSystem<T>::PivotRule pivot_rule{LinearConstrainSystem<T>::PivotRule::DANTZIG}; //!< rule choosing the base-entering variable
+    std::minstd_rand random_engine;             //!< generator of the random choices of PivotRule::RANDOM
+
     // empty constructor
     Tableau() {}
     // copy constructor 
     Tableau(const Tableau<T>& orig);
+    // move constructor
+    Tableau(Tableau<T>&& orig) = default;
+    // copy assignment
+    Tableau& operator=(const Tableau<T>& orig);
+    // move assignment
+    Tableau& operator=(Tableau<T>&& orig) = default;
+    // destructor
+    ~Tableau() = default;
 
     /**
      * @brief method to get number of columns in tableau
      */
-    inline size_t get_total_columns() { return num_variables + slack_variables + surplus_variables + artificial_variables + 1; }
+    inline size_t get_total_columns() const { return num_variables + slack_variables + surplus_variables + artificial_variables + 1; }
     /**
      * @brief method to get index of columns for decisional variables
     */
-    inline size_t get_decVars_index() { return slack_variables + surplus_variables + artificial_variables; }
+    inline size_t get_decVars_index() const { return slack_variables + surplus_variables + artificial_variables; }
+    /**
+     * @brief method to check whether the Big-M part of the reduced cost of a column is positive,
+     * i.e. whether the column can not enter the base without making an artificial variable positive
+     */
+    inline bool has_big_M_cost(size_t column) const { return tableau[num_constrains + 1][column] > big_M_tolerance; }
     
     // method to add system constrains in Tableau
-    void create_initial_tableau(std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains);
-    // method to add objective function row with "Big-M" method
+    void create_initial_tableau(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains);
+    // method to write a range of constrain rows in Tableau
+    void add_constrain_rows(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains, size_t first_row, size_t last_row);
+    // method to move decisional variables into the starting base in place of artificial variables
+    size_t crash_basis();
+    // method to add objective function rows with "Big-M" method
     void add_objFunc_tableau(const std::vector<T>& c, const typename LinearConstrainSystem<T>::OptimizationType type);
     // method to add a row to tableau when the case is LE
-    void add_LE_row_tableau(const std::vector<T>& a, const T& b, size_t current_row);
+    void add_LE_row_tableau(const std::vector<T>& a, const T& b, const T& sign, size_t current_row);
     // method to add a row to tableau when the case is GE
-    void add_GE_row_tableau(const std::vector<T>& a, const T& b, size_t current_row);  
+    void add_GE_row_tableau(const std::vector<T>& a, const T& b, const T& sign, size_t current_row);  
     // method to add a row to tableau when the case is EQ
-    void add_EQ_row_tableau(const std::vector<T>& a, const T& b, size_t current_row);      
+    void add_EQ_row_tableau(const std::vector<T>& a, const T& b, const T& sign, size_t current_row);      
+    // method to find the first position of the minimum in a range of values
+    static size_t find_first_min(const T* values, size_t first_index, size_t last_index);
+    // method to find the first position of the minimum of values, with several threads on long ranges
+    size_t find_min_index(const T* values, size_t size) const;
     // method to identify base entering variable
     int find_pivot_column(); 
+    // method to identify base entering variable among improving columns, for Bland's and random rules
+    int find_improving_column();
     // method to identify base exiting variable
     int find_pivot_row(int pivot_column);
     // method to perform pivot operation
     void pivot(int pivot_row, int pivot_column);
+    // method to set to 0 the M parts of reduced costs within tolerance
+    void clear_big_M_noise();
+    // method to apply to an extra column the row operations of a pivot
+    void transform_column(int pivot_row, int pivot_column, std::vector<T>& column) const;
+    // method to flag columns of artificial variables
+    void get_artificial_mask(std::vector<bool>& mask) const;
+    // method to append the column of a new decisional variable
+    void add_variable_column(const std::vector<T>& column);
+    // method to append a row bounding a decisional variable from above
+    void add_upper_bound_row(size_t variable_column, const T& upper_bound);
+    // method to measure how far the basic solution is from satisfying the original constrains
+    T get_residual(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains);
+    // method to rebuild the tableau of the current base from the original constrains
+    bool reinvert(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains, const std::vector<T>& c,
+                  const typename LinearConstrainSystem<T>::OptimizationType type);
 
     #ifdef PRINT
     /**
@@ -88,47 +158,147 @@ class Tableau {
  */
 template<typename T>
 Tableau<T>::Tableau(const Tableau<T>& orig) {
+    *this = orig;
+}
+
+
+/**
+ * @brief Copy assignment: tableau, base, sizes and settings are copied, the buffers of the
+ * destination are kept to be reused
+ * 
+ * @tparam T 
+ * @param orig original object to be copied
+ * @return 'Tableau<T>&' this tableau
+ */
+template<typename T>
+Tableau<T>& Tableau<T>::operator=(const Tableau<T>& orig) {
+    if (this == &orig) {
+        return *this;
+    }
     tableau = orig.tableau;
     base = orig.base;
+    additional_var_offsets = orig.additional_var_offsets;
     artificial_var_indices = orig.artificial_var_indices;
     num_variables = orig.num_variables;
     num_constrains = orig.num_constrains;
     slack_variables = orig.slack_variables;
     surplus_variables = orig.surplus_variables;
     artificial_variables = orig.artificial_variables;
-    BIG_M = orig.BIG_M;
+    tolerance = orig.tolerance;
+    cost_tolerance = orig.cost_tolerance;
+    big_M_tolerance = orig.big_M_tolerance;
+    parallel_rows_threshold = orig.parallel_rows_threshold;
+    sparse_pivot_threshold = orig.sparse_pivot_threshold;
+    parallel_scan_threshold = orig.parallel_scan_threshold;
+    row_allocator = orig.row_allocator;
+    pivot_rule = orig.pivot_rule;
+    random_engine = orig.random_engine;
+    return *this;
 }
 
 
 /**
  * @brief method to add system constrains in Tableau
  * 
+ * Every row is written directly in place, since the column of its additional variables has
+ * already been computed by LinearConstrainSystem::update_tableau_info: with many constrains
+ * the rows are split among several threads.
+ * 
  * @tparam T
  * @param constrains vector of Constrain objects to represent system constrains
  */
 template<typename T>
-void Tableau<T>::create_initial_tableau(std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains) {
+void Tableau<T>::create_initial_tableau(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains) {
+
+    // rows left by a previous optimization are kept and overwritten, so that repeated
+    // optimizations of systems with the same size do not allocate memory;
+    // the last two rows are the objective function and its Big-M part
+    tableau.resize(constrains.size() + 2, Row(row_allocator));
+    base.resize(constrains.size());
+    artificial_var_indices.clear();
+
+    // saving position of artificial variables: GE and EQ rows after sign normalization
+    for (size_t row = 0; row < constrains.size(); ++row) {
+        const auto& constrain = constrains[row];
+        bool is_LE = constrain.type == LinearConstrainSystem<T>::ConstrainType::LE ? constrain.b >= 0
+                                                                                   : constrain.type == LinearConstrainSystem<T>::ConstrainType::GE && constrain.b < 0;
+        if (!is_LE) {
+            artificial_var_indices.emplace_back(std::make_pair(row, additional_var_offsets[row]));
+        }
+    }
 
-    // for every constrain in Constrain vector
-    for(auto const &constrain: constrains){
+    // number of threads writing rows, at least two once the threshold is reached, also on a single core
+    size_t num_threads = 1;
+    if (constrains.size() >= parallel_rows_threshold) {
+        num_threads = std::max(2u, std::thread::hardware_concurrency());
+    }
 
-        // creating corresponding row in tableau
-        tableau.emplace_back(get_total_columns(), 0);
-        // counter to save current row
-        size_t current_row = tableau.size() - 1;    
+    if (num_threads == 1) {
+        add_constrain_rows(constrains, 0, constrains.size());
+    } else {
+        // every thread writes a contiguous block of rows, errors are forwarded to the caller
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(num_threads);
+        size_t block = (constrains.size() + num_threads - 1) / num_threads;
+        for (size_t t = 0; t < num_threads; ++t) {
+            size_t first_row = std::min(t * block, constrains.size());
+            size_t last_row = std::min(first_row + block, constrains.size());
+            threads.emplace_back([this, &constrains, &errors, t, first_row, last_row]() {
+                try {
+                    add_constrain_rows(constrains, first_row, last_row);
+                } catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    // objective function rows are null until add_objFunc_tableau, so that crash_basis can pivot before it
+    tableau[constrains.size()].assign(get_total_columns(), 0);
+    tableau[constrains.size() + 1].assign(get_total_columns(), 0);
+
+    // buffers of pivot are sized once for the whole optimization
+    pivot_row_nonzeros.reserve(get_total_columns());
+    pivot_column_nonzeros.reserve(tableau.size());
+    entering_column.reserve(constrains.size());
+    scan_values.reserve(std::max(constrains.size(), get_total_columns()));
+}
+
+
+/**
+ * @brief method to write rows [first_row, last_row) of Tableau; rows are independent of each other
+ * 
+ * @tparam T
+ * @param constrains vector of Constrain objects to represent system constrains
+ * @param first_row index of the first row to write
+ * @param last_row index past the last row to write
+ */
+template<typename T>
+void Tableau<T>::add_constrain_rows(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains, size_t first_row, size_t last_row) {
+
+    for (size_t current_row = first_row; current_row < last_row; ++current_row) {
+
+        const auto& constrain = constrains[current_row];
+        // resetting corresponding row in tableau
+        tableau[current_row].assign(get_total_columns(), 0);
 
         switch (constrain.type) {
 
             case LinearConstrainSystem<T>::ConstrainType::LE: {
                 // if constant term is negative
                 if (constrain.b < 0){
-                    // creating a vector with opposite coefficients of a
-                    std::vector<T> a_neg(constrain.a.size());
-                    std::transform(constrain.a.begin(), constrain.a.end(), a_neg.begin(), std::negate<T>()); 
-                    // considering the case as if it was GE
-                    add_GE_row_tableau(a_neg, constrain.b*(-1), current_row);    
+                    // considering the case as if it was GE with opposite coefficients
+                    add_GE_row_tableau(constrain.a, constrain.b, -1, current_row);    
                 } else {
-                    add_LE_row_tableau(constrain.a, constrain.b, current_row);
+                    add_LE_row_tableau(constrain.a, constrain.b, 1, current_row);
                 }
 
                 break;
@@ -137,29 +307,18 @@ void Tableau<T>::create_initial_tableau(std::vector<typename LinearConstrainSyst
             case LinearConstrainSystem<T>::ConstrainType::GE: {
                 // if constant term is negative 
                 if (constrain.b < 0){
-                    // creating a vector with opposite coefficients of a
-                    std::vector<T> a_neg(constrain.a.size());
-                    std::transform(constrain.a.begin(), constrain.a.end(), a_neg.begin(), std::negate<T>()); 
-                    // considering the case as if it was LE
-                    add_LE_row_tableau(a_neg, constrain.b*(-1), current_row);    
+                    // considering the case as if it was LE with opposite coefficients
+                    add_LE_row_tableau(constrain.a, constrain.b, -1, current_row);    
                 } else {
-                    add_GE_row_tableau(constrain.a, constrain.b, current_row);
+                    add_GE_row_tableau(constrain.a, constrain.b, 1, current_row);
                 }
                 
                 break;
             }
 
             case LinearConstrainSystem<T>::ConstrainType::EQ: {
-                // if the constant term is negative
-                if (constrain.b < 0){
-                    // creating a vector with opposite coefficients of a
-                    std::vector<T> a_neg(constrain.a.size());
-                    std::transform(constrain.a.begin(), constrain.a.end(), a_neg.begin(), std::negate<T>()); 
-
-                    add_EQ_row_tableau(a_neg, constrain.b*(-1), current_row);    
-                } else {
-                    add_EQ_row_tableau(constrain.a, constrain.b, current_row);
-                }
+                // if the constant term is negative coefficients are taken with opposite sign
+                add_EQ_row_tableau(constrain.a, constrain.b, (constrain.b < 0) ? -1 : 1, current_row);
 
                 break;
             }
@@ -174,45 +333,23 @@ void Tableau<T>::create_initial_tableau(std::vector<typename LinearConstrainSyst
  * @tparam T
  * @param a vector of constrain's decisional variables coefficients
  * @param b constrain's constant term
+ * @param sign 1, or -1 to add the constrain multiplied by -1
  * @param current_row current row index inside tableau
  */
 template<typename T>
-void Tableau<T>::add_LE_row_tableau(const std::vector<T>& a, const T& b, size_t current_row){
-
-    // if not in the first row
-    if(current_row>0){
-        // for every column reserved to additional variables
-        for (size_t i = 0; i < get_decVars_index(); ++i) {
-            // if in previous row there is an element equal to -1
-            if (tableau[current_row-1][i] == 1 && tableau[current_row-1][i+1] == -1) {
-                // adding coefficient of slack variable
-                tableau[current_row][i+2] = 1;
-                // adding base variable
-                base.emplace_back(i+2);
-                break;
-            // if in previous row there is an element equal to 1
-            }else if(tableau[current_row-1][i] == 1) {
-                // adding coefficient of slack variable                
-                tableau[current_row][i+1] = 1;
-                // adding base variable                  
-                base.emplace_back(i+1);
-                break;
-            }
-        }
-    // if in the first row
-    }else{
-        // adding coefficient of slack variable
-        tableau[current_row][0] = 1;
-        //  adding base variable
-        base.emplace_back(0);
-    }
+void Tableau<T>::add_LE_row_tableau(const std::vector<T>& a, const T& b, const T& sign, size_t current_row){
+
+    // adding coefficient of slack variable
+    tableau[current_row][additional_var_offsets[current_row]] = 1;
+    // adding base variable
+    base[current_row] = additional_var_offsets[current_row];
 
     // inserting coefficients of vector a in correct position
     for (size_t i = 0; i < num_variables; ++i)  {
-        tableau[current_row][get_decVars_index() + i] = a[i];
+        tableau[current_row][get_decVars_index() + i] = sign * a[i];
     }
     // adding constant term
-    tableau[current_row].back() = b;
+    tableau[current_row].back() = sign * b;
 }
 
 
@@ -222,45 +359,23 @@ void Tableau<T>::add_LE_row_tableau(const std::vector<T>& a, const T& b, size_t
  * @tparam T
  * @param a vector for constrain's decisional variables coefficients
  * @param b constrain's constant term
+ * @param sign 1, or -1 to add the constrain multiplied by -1
  * @param current_row tableau's current row index
  */
 template<typename T>
-void Tableau<T>::add_GE_row_tableau(const std::vector<T>& a, const T& b, size_t current_row){
-
-    // if not in first row
-    if(current_row>0){
-        // for every column regarding additional variables
-        for (size_t i = 0; i < get_decVars_index(); ++i) {
-            // if in the previous row there is an element equal to -1
-            if (tableau[current_row-1][i] == 1 && tableau[current_row-1][i+1] == -1) {
-                tableau[current_row][i+2] = 1;  // adding artificial variable
-                tableau[current_row][i+3] = -1;  // adding surplus variable
-                base.emplace_back(i+2);    // updating base
-                // saving position of artificial variable
-                artificial_var_indices.emplace_back(std::make_pair(current_row, i+2));
-                break;
-            }else if(tableau[current_row-1][i] == 1) {
-                tableau[current_row][i+1] = 1;
-                tableau[current_row][i+2] = -1;
-                base.emplace_back(i+1);
-                artificial_var_indices.emplace_back(std::make_pair(current_row, i+1));
-                break;
-            }
-        }
-    // if in the first row
-    }else{
-        tableau[current_row][0] = 1;
-        tableau[current_row][1] = -1;
-        base.emplace_back(0);
-        artificial_var_indices.emplace_back(std::make_pair(current_row, 0));
-    }
+void Tableau<T>::add_GE_row_tableau(const std::vector<T>& a, const T& b, const T& sign, size_t current_row){
+
+    tableau[current_row][additional_var_offsets[current_row]] = 1;      // adding artificial variable
+    tableau[current_row][additional_var_offsets[current_row] + 1] = -1; // adding surplus variable
+    base[current_row] = additional_var_offsets[current_row];            // updating base
+
     // inserting coefficients of vector a in correct place
     for (size_t i = 0; i < num_variables; ++i)  {
 
-        tableau[current_row][get_decVars_index() + i] = a[i];
+        tableau[current_row][get_decVars_index() + i] = sign * a[i];
     } 
     // adding constant term  
-    tableau[current_row].back() = b; 
+    tableau[current_row].back() = sign * b; 
 }
 
 
@@ -270,47 +385,102 @@ void Tableau<T>::add_GE_row_tableau(const std::vector<T>& a, const T& b, size_t
  * @tparam T
  * @param a vector of constrain's decisional variable coefficients
  * @param b constrain's constant term 
+ * @param sign 1, or -1 to add the constrain multiplied by -1
  * @param current_row current row index inside tableau
  */
 template<typename T>
-void Tableau<T>::add_EQ_row_tableau(const std::vector<T>& a, const T& b, size_t current_row){
-
-    // if not in first row
-    if(current_row>0){
-        // for every column reserved to additional variables
-        for (size_t i = 0; i < get_decVars_index(); ++i) {
-            // if there is an element equal to -1 in previous row
-            if (tableau[current_row-1][i] == 1 && tableau[current_row-1][i+1] == -1) {
-                tableau[current_row][i+2] = 1;
-                base.emplace_back(i+2);
-                artificial_var_indices.emplace_back(std::make_pair(current_row, i+2));
-                break;
-            }else if(tableau[current_row-1][i] == 1) {
-                tableau[current_row][i+1] = 1;
-                base.emplace_back(i+1);
-                artificial_var_indices.emplace_back(std::make_pair(current_row, i+1));
-                break;
-            }
-        }
-    // if in first row
-    }else{
-        tableau[current_row][0] = 1;
-        base.emplace_back(0);
-                artificial_var_indices.emplace_back(std::make_pair(current_row, 0));
-    }
+void Tableau<T>::add_EQ_row_tableau(const std::vector<T>& a, const T& b, const T& sign, size_t current_row){
+
+    // adding artificial variable
+    tableau[current_row][additional_var_offsets[current_row]] = 1;
+    base[current_row] = additional_var_offsets[current_row];
 
     // inserting coefficients of vector a in correct position
     for (size_t i = 0; i < num_variables; ++i)  {
 
-        tableau[current_row][get_decVars_index() + i] = a[i];
+        tableau[current_row][get_decVars_index() + i] = sign * a[i];
     }
     // adding constant term
-    tableau[current_row].back() = b;
+    tableau[current_row].back() = sign * b;
+}
+
+
+/**
+ * @brief method to move decisional variables into the starting base in place of artificial
+ * variables, before the objective function rows are added (triangular crash)
+ * 
+ * For every row with an artificial variable in base, decisional variable columns with a positive
+ * element in that row are tried from the sparsest one, since sparse columns disturb few other rows.
+ * A column enters the base only if the row wins its ratio test, so that no constant term becomes
+ * negative. Every column replaced an artificial variable the simplex would otherwise have to drive
+ * out with a pivot.
+ * 
+ * @tparam T
+ * @return 'size_t' number of pivots performed
+ */
+template <typename T>
+size_t Tableau<T>::crash_basis() {
+
+    size_t decVars_index = get_decVars_index();
+
+    // nonzero elements of every decisional variable column in constrain rows
+    crash_counts.assign(num_variables, 0);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        for (size_t j = 0; j < num_variables; ++j) {
+            if (tableau[row][decVars_index + j] != 0) {
+                crash_counts[j]++;
+            }
+        }
+    }
+    // decisional variables from the sparsest column
+    crash_order.resize(num_variables);
+    for (size_t j = 0; j < num_variables; ++j) {
+        crash_order[j] = j;
+    }
+    std::sort(crash_order.begin(), crash_order.end(), [this](size_t lhs, size_t rhs) {
+        return crash_counts[lhs] < crash_counts[rhs] || (crash_counts[lhs] == crash_counts[rhs] && lhs < rhs);
+    });
+    crash_in_base.assign(num_variables, false);
+
+    size_t pivots = 0;
+    for (const auto& indeces : artificial_var_indices) {
+        size_t row = indeces.first;
+        if (base[row] != indeces.second) {
+            continue;
+        }
+        for (size_t j : crash_order) {
+            size_t pivot_column = decVars_index + j;
+            if (crash_in_base[j] || tableau[row][pivot_column] <= tolerance) {
+                continue;
+            }
+            // the row must win the ratio test of the column
+            T ratio = tableau[row].back() / tableau[row][pivot_column];
+            bool feasible = true;
+            for (size_t other_row = 0; other_row < num_constrains && feasible; ++other_row) {
+                T element = tableau[other_row][pivot_column];
+                if (other_row != row && element > tolerance && tableau[other_row].back() < ratio * element) {
+                    feasible = false;
+                }
+            }
+            if (feasible) {
+                pivot(row, pivot_column);
+                crash_in_base[j] = true;
+                pivots++;
+                break;
+            }
+        }
+    }
+    return pivots;
 }
 
 
 /**
- * @brief method to add objective function row with "Big-M" method
+ * @brief method to add objective function rows with "Big-M" method
+ * 
+ * The cost of an artificial variable is M, a value larger than any other: instead of writing a
+ * large number M the objective function is kept as two rows, the coefficients of M and the real
+ * coefficients, which are compared lexicographically by find_pivot_column. This way M never
+ * mixes with the real costs and causes no cancellation.
  * 
  * @tparam T
  * @param c vector of objective function coefficients
@@ -321,8 +491,11 @@ void Tableau<T>::add_objFunc_tableau(const std::vector<T>& c, const typename Lin
 
     // index of objective function row
     size_t ObjFunc_row = num_constrains;
-    // creating a new row inside tableau           
-    tableau.emplace_back(get_total_columns(), 0);
+    // index of the row for coefficients of M
+    size_t BigM_row = num_constrains + 1;
+    // resetting objective function rows, left null by create_initial_tableau and crash_basis
+    std::fill(tableau[ObjFunc_row].begin(), tableau[ObjFunc_row].end(), 0);
+    std::fill(tableau[BigM_row].begin(), tableau[BigM_row].end(), 0);
 
     switch (type) {
 
@@ -345,27 +518,45 @@ void Tableau<T>::add_objFunc_tableau(const std::vector<T>& c, const typename Lin
             break;
         }
     }
-    // Adding constant term as 0 for objective function
-    tableau[ObjFunc_row].back()= 0;
 
     // "Big-M method" phase:
-    // adding M value to artificial variables in objective function row
+    // adding coefficient 1 of M to artificial variables
     for (const auto& indeces : artificial_var_indices) {
-        tableau[ObjFunc_row][indeces.second] = BIG_M;
+        tableau[BigM_row][indeces.second] = 1;
     }
     #ifdef PRINT
     print_tableau();
     #endif // PRINT
 
-    // deleting those values performing adequate linear combinations to objective function
-    for (const auto& indeces : artificial_var_indices) {
-        T factor = tableau[ObjFunc_row][indeces.second];
+    // deleting the costs of base variables subtracting their rows: the artificial variables of the
+    // starting base and the decisional variables moved into it by crash_basis
+    for (size_t row_index = 0; row_index < num_constrains; ++row_index) {
+        T cost = tableau[ObjFunc_row][base[row_index]];
+        T big_M_cost = tableau[BigM_row][base[row_index]];
+        if (cost == 0 && big_M_cost == 0) {
+            continue;
+        }
         for (size_t col_index = 0; col_index < get_total_columns(); ++col_index) {
             // performing linear combinations on rows to make other elements on pivot columns be 0
-            tableau[ObjFunc_row][col_index] -= factor * tableau[indeces.first][col_index];
-        }        
+            tableau[ObjFunc_row][col_index] -= cost * tableau[row_index][col_index];
+            tableau[BigM_row][col_index] -= big_M_cost * tableau[row_index][col_index];
+        }
     }
 
+    // rounding errors of reduced costs grow with their magnitude: pricing tolerances are relative
+    // to the largest value of each objective function row
+    T cost_scale = 1;
+    T big_M_scale = 1;
+    for (size_t col_index = 0; col_index < get_total_columns() - 1; ++col_index) {
+        T cost = tableau[ObjFunc_row][col_index] < 0 ? -tableau[ObjFunc_row][col_index] : tableau[ObjFunc_row][col_index];
+        T big_M_cost = tableau[BigM_row][col_index] < 0 ? -tableau[BigM_row][col_index] : tableau[BigM_row][col_index];
+        cost_scale = cost > cost_scale ? cost : cost_scale;
+        big_M_scale = big_M_cost > big_M_scale ? big_M_cost : big_M_scale;
+    }
+    cost_tolerance = tolerance * cost_scale;
+    big_M_tolerance = tolerance * big_M_scale;
+    clear_big_M_noise();
+
     // now simplex algorithm can start
     #ifdef PRINT
     std::cout << "---Start Simplex---" << std::endl;
@@ -394,24 +585,55 @@ void Tableau<T>::pivot(int pivot_row, int pivot_column) {
     #endif // PRINT
     // number of rows in tableau
     int tot_rows = tableau.size();
+    // number of columns in tableau
+    size_t tot_columns = get_total_columns();
     // pivot element
     T pivot_element = tableau[pivot_row][pivot_column];
     // dividing all elements in pivot row by pivot element
-
-    for (auto& element : tableau[pivot_row]) {
+    Row& pivot_row_values = tableau[pivot_row];
+    for (auto& element : pivot_row_values) {
         element /= pivot_element;
     }
 
-    // substituting all non-pivot rows subtracting to them an adequate multiple of pivot row
+    // rows with a 0 in pivot column are left unchanged by the pivot: collecting the others
+    pivot_column_nonzeros.clear();
     for (int row_index = 0; row_index < tot_rows; ++row_index) {
-        // if not in pivot row
-        if (row_index != pivot_row) {
+        if (row_index != pivot_row && tableau[row_index][pivot_column] != 0) {
+            pivot_column_nonzeros.push_back(row_index);
+        }
+    }
+    // columns with a 0 in pivot row are left unchanged as well
+    pivot_row_nonzeros.clear();
+    for (size_t col_index = 0; col_index < tot_columns; ++col_index) {
+        if (pivot_row_values[col_index] != 0) {
+            pivot_row_nonzeros.push_back(col_index);
+        }
+    }
+
+    // substituting all non-pivot rows subtracting to them an adequate multiple of pivot row
+    if (pivot_row_nonzeros.size() > sparse_pivot_threshold * tot_columns) {
+        // dense pivot row: a contiguous sweep of the row is faster than indirect access
+        for (size_t row_index : pivot_column_nonzeros) {
             T factor = tableau[row_index][pivot_column];
-            for (size_t col_index = 0; col_index < get_total_columns(); ++col_index) {
+            Row& row = tableau[row_index];
+            for (size_t col_index = 0; col_index < tot_columns; ++col_index) {
                 // performing linear combination of row to make other elements in pivot column to be 0
-                tableau[row_index][col_index] -= factor * tableau[pivot_row][col_index];
+                row[col_index] -= factor * pivot_row_values[col_index];
             }
         }
+    } else {
+        // sparse pivot row: updating only the cross product of nonzero rows and columns
+        for (size_t row_index : pivot_column_nonzeros) {
+            T factor = tableau[row_index][pivot_column];
+            Row& row = tableau[row_index];
+            for (size_t col_index : pivot_row_nonzeros) {
+                row[col_index] -= factor * pivot_row_values[col_index];
+            }
+        }
+    }
+    // the M row is the last one
+    if (!pivot_column_nonzeros.empty() && pivot_column_nonzeros.back() == num_constrains + 1) {
+        clear_big_M_noise();
     }
 
     #ifdef PRINT
@@ -421,7 +643,338 @@ void Tableau<T>::pivot(int pivot_row, int pivot_column) {
 
 
 /**
- * @brief method to determine index of base-entering variable column 
+ * @brief method to set to 0 the M parts of reduced costs within tolerance, which are rounding noise,
+ * once no M part is negative: since entering columns then have a null M part, the M row is no longer
+ * updated and noise can not build up into false negatives. While some M part is negative, small ones
+ * are left as they are, since pricing still compares them. It ends every pivot updating the M row
+ * and add_objFunc_tableau, so that pricing only reads the tableau.
+ * 
+ * @tparam T
+ */
+template <typename T>
+void Tableau<T>::clear_big_M_noise() {
+
+    Row& big_M = tableau[num_constrains + 1];
+    // the constant term is not a reduced cost
+    size_t columns = get_total_columns() - 1;
+    for (size_t col_index = 0; col_index < columns; ++col_index) {
+        if (big_M[col_index] < -big_M_tolerance) {
+            return;
+        }
+    }
+    for (size_t col_index = 0; col_index < columns; ++col_index) {
+        if (big_M[col_index] <= big_M_tolerance && big_M[col_index] >= -big_M_tolerance) {
+            big_M[col_index] = 0;
+        }
+    }
+}
+
+
+/**
+ * @brief method to apply to an extra column, e.g. a direction of the constant terms,
+ * the row operations that pivot(pivot_row, pivot_column) will perform: it must be called before pivot
+ * 
+ * @tparam T
+ * @param pivot_row index of base exiting variable row
+ * @param pivot_column index of base entering variable column
+ * @param column one element for every tableau row, objective function row included
+ */
+template <typename T>
+void Tableau<T>::transform_column(int pivot_row, int pivot_column, std::vector<T>& column) const {
+
+    // new value of the pivot row element
+    column[pivot_row] /= tableau[pivot_row][pivot_column];
+    // subtracting to the other rows the same multiple of pivot row used by pivot
+    for (size_t row_index = 0; row_index < tableau.size(); ++row_index) {
+        if (row_index != static_cast<size_t>(pivot_row)) {
+            column[row_index] -= tableau[row_index][pivot_column] * column[pivot_row];
+        }
+    }
+}
+
+
+/**
+ * @brief method to flag columns of artificial variables, which must never enter the base again
+ * during post-optimal analysis
+ * 
+ * @tparam T
+ * @param mask true for every artificial column, one element for every column apart from the constant term
+ */
+template <typename T>
+void Tableau<T>::get_artificial_mask(std::vector<bool>& mask) const {
+
+    mask.assign(num_variables + slack_variables + surplus_variables + artificial_variables, false);
+    for (const auto& indeces : artificial_var_indices) {
+        mask[indeces.second] = true;
+    }
+}
+
+
+/**
+ * @brief method to append the column of a new decisional variable, already expressed in the current base
+ * 
+ * @tparam T
+ * @param column one element for every tableau row, objective function rows included
+ */
+template <typename T>
+void Tableau<T>::add_variable_column(const std::vector<T>& column) {
+
+    // inserting the new column just before the constant term
+    for (size_t row_index = 0; row_index < tableau.size(); ++row_index) {
+        tableau[row_index].insert(tableau[row_index].end() - 1, column[row_index]);
+    }
+    num_variables++;
+}
+
+
+/**
+ * @brief method to append the row x_j + s = upper_bound, with the new slack variable s in base
+ * 
+ * The slack column is inserted at the end of the additional variables, so decisional variable
+ * columns move one place right. x_j must be out of base: the row is then already expressed in the
+ * current base.
+ * 
+ * @tparam T
+ * @param variable_column column of the bounded decisional variable, before the slack column is inserted
+ * @param upper_bound non negative upper bound
+ */
+template <typename T>
+void Tableau<T>::add_upper_bound_row(size_t variable_column, const T& upper_bound) {
+
+    // index of the new slack column
+    size_t slack_column = get_decVars_index();
+    for (auto& row : tableau) {
+        row.insert(row.begin() + slack_column, 0);
+    }
+    for (auto& base_column : base) {
+        if (base_column >= slack_column) {
+            base_column++;
+        }
+    }
+    slack_variables++;
+
+    // inserting the new row before objective function rows
+    Row row(get_total_columns(), 0, row_allocator);
+    row[slack_column] = 1;
+    row[variable_column + 1] = 1;
+    row.back() = upper_bound;
+    tableau.insert(tableau.begin() + num_constrains, row);
+    base.push_back(slack_column);
+    additional_var_offsets.push_back(slack_column);
+    num_constrains++;
+}
+
+
+/**
+ * @brief method to measure how far the basic solution is from satisfying the original constrains:
+ * rounding errors of many pivots make the constant terms drift from the solution of the base
+ * 
+ * @tparam T
+ * @param constrains vector of Constrain objects the tableau has been built from
+ * @return 'T' largest residual of a constrain, relative to 1 + |b|
+ */
+template <typename T>
+T Tableau<T>::get_residual(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains) {
+
+    typedef typename LinearConstrainSystem<T>::ConstrainType ConstrainType;
+
+    // value of every variable: basic ones are read from constant terms, the others are 0
+    variable_values.assign(get_total_columns() - 1, 0);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        variable_values[base[row]] = tableau[row].back();
+    }
+
+    T residual = 0;
+    for (size_t row = 0; row < num_constrains; ++row) {
+        const auto& constrain = constrains[row];
+        // rows with negative constant term have been multiplied by -1 inside tableau
+        T sign = (constrain.b < 0) ? -1 : 1;
+        bool is_LE = constrain.type == ConstrainType::LE ? constrain.b >= 0 : constrain.type == ConstrainType::GE && constrain.b < 0;
+
+        T value = 0;
+        for (size_t j = 0; j < num_variables; ++j) {
+            value += constrain.a[j] * variable_values[get_decVars_index() + j];
+        }
+        value = sign * (value - constrain.b) + variable_values[additional_var_offsets[row]];
+        // surplus variable (GE)
+        if (!is_LE && constrain.type != ConstrainType::EQ) {
+            value -= variable_values[additional_var_offsets[row] + 1];
+        }
+
+        T magnitude = (value < 0) ? -value : value;
+        T scale = 1 + ((constrain.b < 0) ? -constrain.b : constrain.b);
+        if (magnitude / scale > residual) {
+            residual = magnitude / scale;
+        }
+    }
+    return residual;
+}
+
+
+/**
+ * @brief method to rebuild the tableau of the current base from the original constrains,
+ * dropping the rounding errors accumulated by pivot
+ * 
+ * The initial tableau is built again and the variables of the current base enter it by
+ * Gauss-Jordan elimination, choosing for every column the free row with the largest element.
+ * Variables of the starting base that are still in base keep their row. Base variables may end up
+ * in different rows, which does not change the basic solution. Columns without an element above
+ * tolerance in the free rows are left out: the rows they would take keep their starting variable.
+ * 
+ * @tparam T
+ * @param constrains vector of Constrain objects the tableau has been built from
+ * @param c objective function coefficients
+ * @param type optimization type
+ * @return true if every variable of the base has entered the tableau, false if the base is singular
+ */
+template <typename T>
+bool Tableau<T>::reinvert(const std::vector<typename LinearConstrainSystem<T>::Constrain>& constrains, const std::vector<T>& c,
+                          const typename LinearConstrainSystem<T>::OptimizationType type) {
+
+    reinvert_base.assign(base.begin(), base.end());
+    reinvert_columns.assign(get_total_columns() - 1, false);
+    for (size_t column : reinvert_base) {
+        reinvert_columns[column] = true;
+    }
+
+    create_initial_tableau(constrains);
+    add_objFunc_tableau(c, type);
+
+    // rows whose starting base variable is still in base are already in place
+    reinvert_rows.assign(num_constrains, false);
+    for (size_t row = 0; row < num_constrains; ++row) {
+        if (reinvert_columns[base[row]]) {
+            reinvert_rows[row] = true;
+            reinvert_columns[base[row]] = false;
+        }
+    }
+
+    for (size_t column : reinvert_base) {
+        if (!reinvert_columns[column]) {
+            continue;
+        }
+        // free row with the largest element, for numerical stability
+        int pivot_row = -1;
+        T max_element = tolerance;
+        for (size_t row = 0; row < num_constrains; ++row) {
+            T element = tableau[row][column] < 0 ? -tableau[row][column] : tableau[row][column];
+            if (!reinvert_rows[row] && element > max_element) {
+                pivot_row = row;
+                max_element = element;
+            }
+        }
+        if (pivot_row != -1) {
+            pivot(pivot_row, column);
+            reinvert_rows[pivot_row] = true;
+        }
+    }
+    for (size_t row = 0; row < num_constrains; ++row) {
+        if (!reinvert_rows[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief method to find the first position of the minimum of values[first_index, last_index)
+ * 
+ * The minimum is reduced over independent lanes, a branch free loop that the compiler turns into
+ * SIMD min instructions, then a second pass looks for its first occurrence: ties always go to the
+ * smallest index, as in a plain sequential scan.
+ * 
+ * @tparam T
+ * @param values pointer to the first value
+ * @param first_index first position of the range
+ * @param last_index position after the last one of the range, greater than first_index
+ * @return 'size_t' position of the first minimum
+ */
+template <typename T>
+size_t Tableau<T>::find_first_min(const T* values, size_t first_index, size_t last_index) {
+
+    const size_t LANES = 8;
+    T lane_min[LANES];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        lane_min[lane] = values[first_index];
+    }
+    size_t index = first_index;
+    for (; index + LANES <= last_index; index += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            lane_min[lane] = values[index + lane] < lane_min[lane] ? values[index + lane] : lane_min[lane];
+        }
+    }
+    T min_value = lane_min[0];
+    for (size_t lane = 1; lane < LANES; ++lane) {
+        min_value = lane_min[lane] < min_value ? lane_min[lane] : min_value;
+    }
+    for (; index < last_index; ++index) {
+        min_value = values[index] < min_value ? values[index] : min_value;
+    }
+
+    // first occurrence of the minimum
+    for (index = first_index; index < last_index; ++index) {
+        if (values[index] == min_value) {
+            return index;
+        }
+    }
+    return first_index;
+}
+
+
+/**
+ * @brief method to find the first position of the minimum of values[0, size); ranges longer than
+ * parallel_scan_threshold are split in contiguous blocks among the threads of scan_pool, and block
+ * results are merged in order so that the result does not depend on the number of threads
+ * 
+ * The threads are started by the first parallel scan and wait between scans, so that pricing and
+ * ratio test of every pivot do not start new ones.
+ * 
+ * @tparam T
+ * @param values pointer to the first value
+ * @param size number of values, greater than 0
+ * @return 'size_t' position of the first minimum
+ */
+template <typename T>
+size_t Tableau<T>::find_min_index(const T* values, size_t size) const {
+
+    if (size < parallel_scan_threshold || std::thread::hardware_concurrency() <= 1) {
+        return find_first_min(values, 0, size);
+    }
+    if (!scan_pool) {
+        scan_pool.reset(new WorkerPool(std::thread::hardware_concurrency()));
+    }
+
+    // every thread scans a contiguous block of values
+    size_t num_threads = scan_pool->size();
+    size_t block = (size + num_threads - 1) / num_threads;
+    std::vector<size_t>& block_min = scan_block_min;
+    block_min.assign(num_threads, size);
+    scan_pool->run([values, size, block, &block_min](size_t t) {
+        size_t first_index = std::min(t * block, size);
+        size_t last_index = std::min(first_index + block, size);
+        if (first_index < last_index) {
+            block_min[t] = find_first_min(values, first_index, last_index);
+        }
+    });
+    // a later block wins only with a strictly smaller value
+    size_t min_index = block_min[0];
+    for (size_t t = 1; t < num_threads && block_min[t] != size; ++t) {
+        if (values[block_min[t]] < values[min_index]) {
+            min_index = block_min[t];
+        }
+    }
+    return min_index;
+}
+
+
+/**
+ * @brief method to determine index of base-entering variable column, comparing reduced costs
+ * lexicographically on (M part, real part): a negative M part always wins, the real part decides
+ * when M part is 0
+ * 
+ * With PivotRule::DANTZIG the most negative reduced cost enters the base, the other rules are
+ * implemented by find_improving_column.
  * 
  * @tparam T
  * @return 'int' index of base-entering variable columns
@@ -429,24 +982,90 @@ void Tableau<T>::pivot(int pivot_row, int pivot_column) {
 template <typename T>
 int Tableau<T>::find_pivot_column() {
 
+    if (pivot_rule != LinearConstrainSystem<T>::PivotRule::DANTZIG) {
+        return find_improving_column();
+    }
     // initially assigning index as -1 to deal with particular cases
     int pivot_column = -1;
-    // pivot_value will be used for comparisons to find minimum negative value in objective function row
-    T pivot_value = 0; 
-    // index of objective function row
+    // index of objective function rows
     size_t ObjFunc_row = num_constrains;
+    size_t BigM_row = num_constrains + 1;
+    // number of reduced costs (constant term excluded)
+    size_t columns = get_total_columns() - 1;
+    const Row& big_M = tableau[BigM_row];
+    const Row& obj = tableau[ObjFunc_row];
+
+    // minimum M part over the whole row, ties go to the smallest index
+    size_t column = find_min_index(big_M.data(), columns);
+    if (big_M[column] < -big_M_tolerance) {
+        pivot_column = column;
+    } else {
+        // no M part is negative: real parts of columns whose M part is null, i.e. within tolerance
+        // (see clear_big_M_noise), are compared
+        scan_values.resize(columns);
+        for (size_t col_index = 0; col_index < columns; ++col_index) {
+            bool null_M = big_M[col_index] <= big_M_tolerance;
+            scan_values[col_index] = null_M ? obj[col_index] : 0;
+        }
+        column = find_min_index(scan_values.data(), columns);
+        if (scan_values[column] < -cost_tolerance) {
+            pivot_column = column;
+        }
+    }
+    #ifdef PRINT
+    std::cout<<"Pivot column entering: "<< pivot_column<< std::endl;
+    #endif // PRINT
+    return pivot_column;
+}
 
-    // analyzing all coefficients of objective function row (apart from its constant term) 
-    // searching for the minimum among its negative values
-    for (size_t col_index = 0; col_index < get_total_columns() - 1; ++col_index) {
 
-        // if objective function coefficient is negative, let's check if it is the minimum so far
-        if ( tableau[ObjFunc_row][col_index] < 0 && tableau[ObjFunc_row][col_index] < pivot_value ){
+/**
+ * @brief method to determine index of base-entering variable column among the improving ones,
+ * i.e. columns with a negative M part or, when there are none, with a null M part and a negative
+ * real part
+ * 
+ * PivotRule::BLAND takes the first improving column, PivotRule::RANDOM one drawn with the same
+ * probability from all of them.
+ * 
+ * @tparam T
+ * @return 'int' index of base-entering variable column
+ */
+template <typename T>
+int Tableau<T>::find_improving_column() {
+
+    int pivot_column = -1;
+    size_t ObjFunc_row = num_constrains;
+    size_t BigM_row = num_constrains + 1;
+    size_t columns = get_total_columns() - 1;
+    const Row& big_M = tableau[BigM_row];
+    const Row& obj = tableau[ObjFunc_row];
+
+    bool negative_M = false;
+    for (size_t col_index = 0; col_index < columns && !negative_M; ++col_index) {
+        negative_M = big_M[col_index] < -big_M_tolerance;
+    }
+    // number of improving columns; M parts within tolerance are rounding noise, see find_pivot_column
+    size_t improving = 0;
+    for (size_t col_index = 0; col_index < columns; ++col_index) {
+        bool is_improving = negative_M ? big_M[col_index] < -big_M_tolerance
+                                       : big_M[col_index] <= big_M_tolerance && obj[col_index] < -cost_tolerance;
+        if (is_improving) {
+            if (improving == 0) {
+                pivot_column = col_index;
+            }
+            improving++;
+        }
+    }
 
-            // updating index of pivot column
-            pivot_column = col_index;
-            // updating minimum value found so far
-            pivot_value = tableau[ObjFunc_row][col_index];
+    if (pivot_rule == LinearConstrainSystem<T>::PivotRule::RANDOM && improving > 1) {
+        size_t chosen = std::uniform_int_distribution<size_t>(0, improving - 1)(random_engine);
+        for (size_t col_index = 0; col_index < columns; ++col_index) {
+            bool is_improving = negative_M ? big_M[col_index] < -big_M_tolerance
+                                           : big_M[col_index] <= big_M_tolerance && obj[col_index] < -cost_tolerance;
+            if (is_improving && chosen-- == 0) {
+                pivot_column = col_index;
+                break;
+            }
         }
     }
     #ifdef PRINT
@@ -459,6 +1078,9 @@ int Tableau<T>::find_pivot_column() {
 /**
  * @brief method to find index of base exiting variable
  * 
+ * Pivot column and constant terms are first copied in contiguous buffers, so that ratios and their
+ * minimum are computed on consecutive memory instead of striding through separate rows.
+ * 
  * @tparam T
  * @param pivot_column index of base entering variable
  * @return 'int' index of base exiting variable row
@@ -468,26 +1090,35 @@ int Tableau<T>::find_pivot_row(int pivot_column) {
 
     // initially, base variable index is set to -1 to deal with particular cases
     int pivot_row = -1;
-    // setting the highest possible value for ratio that will be used to identify the minimum among all ratios
-    double min_ratio = std::numeric_limits<T>::max();
-    // objective function row
-    size_t ObjFunc_row = num_constrains;
-
-    // for every row apart from objective function one
-    for (size_t row_index = 0; row_index < ObjFunc_row; ++row_index)  {
-
-        // if coefficient in current tableau row is positive
-        if (tableau[row_index][pivot_column] > 0) {
-
-            // calculating ratio between constant term and coefficient in current tableau row
-            double ratio = tableau[row_index].back() / tableau[row_index][pivot_column];
+    if (num_constrains == 0) {
+        return pivot_row;
+    }
+    // value given to rows that can not leave the base
+    const T max_ratio = std::numeric_limits<T>::max();
+
+    entering_column.resize(num_constrains);
+    scan_values.resize(num_constrains);
+    for (size_t row_index = 0; row_index < num_constrains; ++row_index) {
+        entering_column[row_index] = tableau[row_index][pivot_column];
+        scan_values[row_index] = tableau[row_index].back();
+    }
+    // ratio between constant term and coefficient, only for positive coefficients
+    // (values within tolerance are rounding noise)
+    for (size_t row_index = 0; row_index < num_constrains; ++row_index) {
+        scan_values[row_index] = entering_column[row_index] > tolerance ? scan_values[row_index] / entering_column[row_index] : max_ratio;
+    }
 
-            // if ratio is less than minimum ratio found so far
-            if (ratio < min_ratio) {
-                // updating index of selected base variable 
-                pivot_row = row_index;
-                // updating minimum ratio value
-                min_ratio = ratio;
+    // minimum ratio, ties go to the smallest row index
+    size_t row = find_min_index(scan_values.data(), num_constrains);
+    if (scan_values[row] < max_ratio) {
+        pivot_row = row;
+        // Bland's rule: ties go to the base variable with the smallest index, so that the simplex
+        // never cycles on degenerate pivots
+        if (pivot_rule == LinearConstrainSystem<T>::PivotRule::BLAND) {
+            for (size_t row_index = row + 1; row_index < num_constrains; ++row_index) {
+                if (scan_values[row_index] == scan_values[row] && base[row_index] < base[pivot_row]) {
+                    pivot_row = row_index;
+                }
             }
         }
     }
@@ -0,0 +1,119 @@
+#ifndef __WORKERPOOL_HPP__
+#define __WORKERPOOL_HPP__
+
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+/**
+ * @brief class for a fixed set of threads running the parts of a task together
+ *
+ * Threads are started once by the constructor and wait for tasks between calls of run, so that
+ * loops executed at every pivot, such as the scans of pricing and ratio test, can be split among
+ * threads without starting new ones every time.
+ */
+class WorkerPool {
+
+    std::vector<std::thread> workers;       //!< threads running the parts 1..size()-1 of every task
+    std::mutex mutex;                       //!< mutex protecting the members below
+    std::condition_variable task_ready;     //!< notified when a new task is available or the pool stops
+    std::condition_variable task_done;      //!< notified when the last worker has finished its part
+    std::function<void(size_t)> task;       //!< task of the current call of run, called with the index of the part
+    size_t generation{0};                   //!< number of tasks started so far
+    size_t pending{0};                      //!< number of workers still running their part of the current task
+    bool stopping{false};                   //!< flag set by the destructor
+
+    // method executed by every worker thread
+    void work(size_t part);
+
+  public:
+
+    /**
+     * @brief constructor, starting num_threads - 1 threads: the thread calling run executes part 0
+     *
+     * @param num_threads number of parts of every task, at least 1
+     */
+    explicit WorkerPool(size_t num_threads) {
+        for (size_t part = 1; part < num_threads; ++part) {
+            workers.emplace_back(&WorkerPool::work, this, part);
+        }
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief destructor, stopping and joining the threads
+     */
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        task_ready.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief method to get the number of parts of every task
+     */
+    inline size_t size() const { return workers.size() + 1; }
+
+    // method to run task(part) for every part, returning when all of them have finished
+    void run(const std::function<void(size_t)>& part_task);
+};
+
+
+/**
+ * @brief method executed by every worker thread: it runs its part of every new task until the pool stops
+ *
+ * @param part index of the part of the worker
+ */
+inline void WorkerPool::work(size_t part) {
+
+    size_t last_generation = 0;
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex);
+        task_ready.wait(lock, [this, last_generation]() { return stopping || generation != last_generation; });
+        if (stopping) {
+            return;
+        }
+        last_generation = generation;
+        lock.unlock();
+        task(part);
+        lock.lock();
+        if (--pending == 0) {
+            task_done.notify_one();
+        }
+    }
+}
+
+
+/**
+ * @brief method to run part_task(part) for every part in [0, size()), part 0 on the calling thread;
+ * it returns when all the parts have finished. part_task must not throw.
+ *
+ * @param part_task task to be run, called once with the index of every part
+ */
+inline void WorkerPool::run(const std::function<void(size_t)>& part_task) {
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = part_task;
+        pending = workers.size();
+        ++generation;
+    }
+    task_ready.notify_all();
+    part_task(0);
+    std::unique_lock<std::mutex> lock(mutex);
+    task_done.wait(lock, [this]() { return pending == 0; });
+}
+
+#endif // __WORKERPOOL_HPP__
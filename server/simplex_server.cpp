@@ -0,0 +1,50 @@
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <pthread.h>
+
+#include "../include/SimplexServer.hpp"
+
+
+/**
+ * @brief solver daemon: simplex_server <socket path> [workers] [batch size]
+ *
+ * Runs until SIGINT or SIGTERM, then removes the socket.
+ */
+int main(int argc, char* argv[]) {
+
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <socket path> [workers] [batch size]" << std::endl;
+        return 1;
+    }
+    std::string path = argv[1];
+    size_t num_workers = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+    size_t batch_size = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 64;
+
+    // signals are waited for by the main thread only: they are blocked before any thread starts
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    // optimize prints every problem and result: the daemon stays silent
+    std::cout.setstate(std::ios::failbit);
+
+    try {
+        SimplexServer server(path, num_workers, batch_size);
+        std::thread acceptor(&SimplexServer::run, &server);
+        std::cerr << "simplex_server listening on " << path << std::endl;
+        int signal = 0;
+        sigwait(&signals, &signal);
+        server.stop();
+        acceptor.join();
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,242 @@
+#ifndef __TESTUTILS_HPP__
+#define __TESTUTILS_HPP__
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/LinearConstrainSystem.hpp"
+
+
+/**
+ * @brief helpers shared by the tests: a check macro counting failures, and the problems of the
+ * examples, plus a degenerate and an infeasible one, solved by LinearConstrainSystem as reference
+ */
+namespace TestUtils {
+
+    typedef LinearConstrainSystem<double> System;
+
+    /**
+     * @brief struct representing a problem and its expected result
+    */
+    struct Problem {
+        std::string name;                       //!< name printed by failed checks
+        std::vector<System::Constrain> constrains;  //!< constrains of the problem
+        std::vector<double> c;                  //!< objective function coefficients
+        System::OptimizationType type;          //!< optimization type
+        System::SolutionType expected;          //!< expected solution type
+        double z;                               //!< expected optimal value, if bounded and known in advance
+    };
+
+    /**
+     * @brief method to get the number of failed checks so far
+     */
+    inline int& failures() {
+        static int count = 0;
+        return count;
+    }
+
+    /**
+     * @brief method to record a check, printing it if it fails
+     */
+    inline void check(bool condition, const char* text, const char* file, int line) {
+        if (!condition) {
+            std::cerr << file << ":" << line << ": check failed: " << text << std::endl;
+            failures()++;
+        }
+    }
+
+    #define CHECK(condition) TestUtils::check((condition), #condition, __FILE__, __LINE__)
+
+    /**
+     * @brief method to compare two values up to a tolerance relative to their magnitude
+     */
+    inline bool near(double value, double expected, double tolerance = 1e-7) {
+        return std::fabs(value - expected) <= tolerance * (1 + std::fabs(expected));
+    }
+
+    /**
+     * @brief method to compare two solutions element by element
+     */
+    inline bool near(const std::vector<double>& values, const std::vector<double>& expected, double tolerance = 1e-7) {
+        if (values.size() != expected.size()) {
+            return false;
+        }
+        for (size_t j = 0; j < values.size(); ++j) {
+            if (!near(values[j], expected[j], tolerance)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief method to get the problems of the examples, plus a degenerate one, one with negative
+     * constant terms and a trivially infeasible one
+     */
+    inline std::vector<Problem> example_problems() {
+
+        typedef System::ConstrainType Type;
+        std::vector<Problem> problems(7);
+
+        // examples/main.cpp
+        problems[0].name = "main";
+        problems[0].constrains = {{{1, 0, 1}, 5, Type::EQ}, {{0, 1, 1}, 10, Type::GE}, {{1, 1, 0}, 20, Type::LE}};
+        problems[0].c = {1, -1, 3};
+        problems[0].type = System::OptimizationType::MAX;
+        problems[0].expected = System::SolutionType::BOUNDED;
+        problems[0].z = 10;
+
+        // examples/mainMIN.cpp
+        problems[1].name = "mainMIN";
+        problems[1].constrains = {{{2, 1}, 8, Type::LE}, {{1, 2}, 9, Type::LE}, {{1, 1}, 5, Type::LE}};
+        problems[1].c = {-5, -7};
+        problems[1].type = System::OptimizationType::MIN;
+        problems[1].expected = System::SolutionType::BOUNDED;
+        problems[1].z = -33;
+
+        // examples/mainUNBOUND.cpp
+        problems[2].name = "mainUNBOUND";
+        problems[2].constrains = {{{1, -4}, 8, Type::LE}, {{-1, 1}, 6, Type::LE}, {{-3, 2}, 5, Type::LE}};
+        problems[2].c = {2, 5};
+        problems[2].type = System::OptimizationType::MAX;
+        problems[2].expected = System::SolutionType::UNBOUNDED;
+        problems[2].z = 0;
+
+        // examples/mainINFEASIBLE.cpp
+        problems[3].name = "mainINFEASIBLE";
+        problems[3].constrains = {{{2, 3}, 1200, Type::GE}, {{1, 1}, 400, Type::LE}, {{2, 1.5}, 900, Type::GE}};
+        problems[3].c = {-2, -1};
+        problems[3].type = System::OptimizationType::MIN;
+        problems[3].expected = System::SolutionType::INFEASIBLE;
+        problems[3].z = 0;
+
+        // degenerate: the starting base has a basic variable at 0 and the optimum is overdetermined
+        problems[4].name = "degenerate";
+        problems[4].constrains = {{{1, -1}, 0, Type::LE}, {{1, 0}, 1, Type::LE}, {{0, 1}, 1, Type::LE}, {{1, 1}, 2, Type::LE}};
+        problems[4].c = {1, 1};
+        problems[4].type = System::OptimizationType::MAX;
+        problems[4].expected = System::SolutionType::BOUNDED;
+        problems[4].z = 2;
+
+        // negative constant terms: rows are multiplied by -1 inside the tableau
+        problems[5].name = "negative_b";
+        problems[5].constrains = {{{-1, -1}, -3, Type::LE}, {{1, 0}, 2, Type::LE}, {{-1, 1}, -1, Type::EQ}};
+        problems[5].c = {1, 2};
+        problems[5].type = System::OptimizationType::MIN;
+        problems[5].expected = System::SolutionType::BOUNDED;
+        problems[5].z = 4;
+
+        // x1 + x2 <= 1 and x1 + x2 >= 2
+        problems[6].name = "infeasible";
+        problems[6].constrains = {{{1, 1}, 1, Type::LE}, {{1, 1}, 2, Type::GE}};
+        problems[6].c = {1, 1};
+        problems[6].type = System::OptimizationType::MAX;
+        problems[6].expected = System::SolutionType::INFEASIBLE;
+        problems[6].z = 0;
+
+        return problems;
+    }
+
+    /**
+     * @brief method to add the constrains of a problem to a system
+     */
+    inline void load(System& system, const Problem& problem) {
+        for (const auto& constrain : problem.constrains) {
+            system.add_constrain(constrain.a, constrain.b, constrain.type);
+        }
+    }
+
+    /**
+     * @brief method to optimize a problem loaded in a system, reporting infeasibility as
+     * SolutionType::INFEASIBLE instead of an exception
+     */
+    inline System::SolutionType solve(System& system, const Problem& problem, std::vector<double>& solution) {
+        try {
+            return system.optimize(solution, problem.c, problem.type);
+        } catch (const InfeasibleSystemError&) {
+            return System::SolutionType::INFEASIBLE;
+        }
+    }
+
+    /**
+     * @brief method to solve a problem with LinearConstrainSystem, the reference of the other solvers
+     */
+    inline System::SolutionType solve_reference(const Problem& problem, std::vector<double>& solution) {
+        System system;
+        load(system, problem);
+        return solve(system, problem, solution);
+    }
+
+    /**
+     * @brief method to generate a random sparse problem with LE rows, bounded since every variable
+     * appears in a row with positive coefficients and constant terms
+     */
+    inline Problem random_problem(size_t rows, size_t columns, double density, unsigned seed) {
+        std::minstd_rand engine(seed);
+        std::uniform_real_distribution<double> value(0.5, 10);
+        std::uniform_real_distribution<double> uniform(0, 1);
+        Problem problem;
+        problem.name = "random_" + std::to_string(seed);
+        problem.constrains.resize(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            problem.constrains[i].a.assign(columns, 0);
+            for (size_t j = 0; j < columns; ++j) {
+                if (uniform(engine) < density || j % rows == i) {
+                    problem.constrains[i].a[j] = value(engine);
+                }
+            }
+            problem.constrains[i].b = 10 * value(engine);
+            problem.constrains[i].type = System::ConstrainType::LE;
+        }
+        problem.c.resize(columns);
+        for (auto& coefficient : problem.c) {
+            coefficient = value(engine);
+        }
+        problem.type = System::OptimizationType::MAX;
+        problem.expected = System::SolutionType::BOUNDED;
+        problem.z = 0;
+        return problem;
+    }
+
+    /**
+     * @brief method to check that a solution satisfies the constrains of a problem
+     */
+    inline bool satisfies(const Problem& problem, const std::vector<double>& solution, double tolerance = 1e-7) {
+        for (const auto& constrain : problem.constrains) {
+            double value = 0;
+            for (size_t j = 0; j < constrain.a.size(); ++j) {
+                value += constrain.a[j] * solution[j];
+            }
+            double slack = tolerance * (1 + std::fabs(constrain.b));
+            if ((constrain.type != System::ConstrainType::GE && value > constrain.b + slack) ||
+                (constrain.type != System::ConstrainType::LE && value < constrain.b - slack)) {
+                return false;
+            }
+        }
+        for (size_t j = 0; j + 1 < solution.size(); ++j) {
+            if (solution[j] < -tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief method to print the number of failed checks
+     * @return 'int' exit code of the test, 0 if every check passed
+     */
+    inline int report() {
+        if (failures() == 0) {
+            std::cout << "All checks passed" << std::endl;
+            return 0;
+        }
+        std::cerr << failures() << " checks failed" << std::endl;
+        return 1;
+    }
+}
+
+#endif // __TESTUTILS_HPP__
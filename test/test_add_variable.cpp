@@ -0,0 +1,93 @@
+// Variables added to a solved system compared with the system solved from scratch with the new column
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+/**
+ * @brief method to append a column, and the row of its upper bound if finite, to a problem
+ */
+TestUtils::Problem extend(const TestUtils::Problem& problem, const std::vector<double>& column, double cost, double upper_bound) {
+
+    TestUtils::Problem extended = problem;
+    for (size_t i = 0; i < column.size(); ++i) {
+        extended.constrains[i].a.push_back(column[i]);
+    }
+    extended.c.push_back(cost);
+    if (upper_bound < std::numeric_limits<double>::infinity()) {
+        std::vector<double> bound(extended.c.size(), 0);
+        bound.back() = 1;
+        extended.constrains.emplace_back(bound, upper_bound, TestUtils::System::ConstrainType::LE);
+    }
+    return extended;
+}
+
+
+int main() {
+
+    typedef TestUtils::System System;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    for (const auto& problem : TestUtils::example_problems()) {
+        if (problem.expected != System::SolutionType::BOUNDED) {
+            // without an optimal tableau there is no base to add the column to
+            System system;
+            TestUtils::load(system, problem);
+            std::vector<double> solution;
+            TestUtils::solve(system, problem, solution);
+            bool rejected = false;
+            try {
+                system.add_variable(solution, std::vector<double>(problem.constrains.size(), 1), 1);
+            } catch (const std::logic_error&) {
+                rejected = true;
+            }
+            CHECK(rejected);
+            continue;
+        }
+        // columns that price out both attractive and unattractive, with and without upper bound
+        for (double cost_factor : {3.0, -1.0}) {
+            for (double upper_bound : {infinity, 1.5}) {
+                std::cout << "Problem " << problem.name << ", cost factor " << cost_factor << ", upper bound " << upper_bound << std::endl;
+                std::vector<double> column(problem.constrains.size());
+                for (size_t i = 0; i < column.size(); ++i) {
+                    column[i] = (i % 2 == 0) ? 1 : 0.5;
+                }
+                double cost = 0;
+                for (double coefficient : problem.c) {
+                    cost = std::max(cost, coefficient < 0 ? -coefficient : coefficient);
+                }
+                cost *= (problem.type == System::OptimizationType::MAX) ? cost_factor : -cost_factor;
+
+                System system;
+                TestUtils::load(system, problem);
+                std::vector<double> solution;
+                CHECK(TestUtils::solve(system, problem, solution) == System::SolutionType::BOUNDED);
+                System::SolutionType sol_type = system.add_variable(solution, column, cost, upper_bound);
+
+                TestUtils::Problem extended = extend(problem, column, cost, upper_bound);
+                std::vector<double> expected;
+                System::SolutionType reference = TestUtils::solve_reference(extended, expected);
+                CHECK(sol_type == reference);
+                if (sol_type == System::SolutionType::BOUNDED) {
+                    CHECK(solution.size() == extended.c.size() + 1);
+                    CHECK(TestUtils::near(solution.back(), expected.back()));
+                    CHECK(TestUtils::satisfies(extended, solution));
+                    // duals of the continued optimization price every column of the extended problem
+                    std::vector<double> duals;
+                    system.get_duals(duals);
+                    CHECK(duals.size() == extended.constrains.size());
+                    double dual_z = 0;
+                    for (size_t i = 0; i < duals.size(); ++i) {
+                        dual_z += duals[i] * extended.constrains[i].b;
+                    }
+                    CHECK(TestUtils::near(dual_z, solution.back()));
+                }
+            }
+        }
+    }
+
+    return TestUtils::report();
+}
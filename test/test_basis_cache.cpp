@@ -0,0 +1,168 @@
+// BasisCache: fingerprints, LRU eviction, and warm-started optimizations compared with LinearConstrainSystem
+
+#include <memory>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+typedef System::ConstrainType Type;
+
+
+/**
+ * @brief method to get the fingerprint of a system given by its rows
+ */
+uint64_t fingerprint(const std::vector<System::Constrain>& constrains) {
+    return BasisCache<double>::fingerprint(constrains);
+}
+
+
+/**
+ * @brief method to solve a problem on a new system sharing cache, comparing it with LinearConstrainSystem
+ * @return 'size_t' pivots of the optimization
+ */
+size_t check_cached(const TestUtils::Problem& problem, const std::shared_ptr<BasisCache<double>>& cache) {
+    std::vector<double> expected;
+    std::vector<double> solution;
+    System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+    System system;
+    system.set_basis_cache(cache);
+    TestUtils::load(system, problem);
+    System::SolutionType sol_type = TestUtils::solve(system, problem, solution);
+    CHECK(sol_type == reference);
+    if (sol_type == System::SolutionType::BOUNDED && reference == System::SolutionType::BOUNDED) {
+        CHECK(TestUtils::near(solution.back(), expected.back()));
+        CHECK(TestUtils::satisfies(problem, solution));
+    }
+    return system.get_iterations();
+}
+
+
+/**
+ * @brief method to get a problem with the same structure and slightly different values
+ */
+TestUtils::Problem perturbed(TestUtils::Problem problem, double factor) {
+    for (size_t i = 0; i < problem.constrains.size(); ++i) {
+        auto& constrain = problem.constrains[i];
+        constrain.b *= 1 + factor * static_cast<double>(i % 3);
+        for (size_t j = 0; j < constrain.a.size(); ++j) {
+            constrain.a[j] *= 1 + factor * static_cast<double>((i + j) % 2);
+        }
+    }
+    for (size_t j = 0; j < problem.c.size(); ++j) {
+        problem.c[j] *= 1 + factor * static_cast<double>(j % 2);
+    }
+    return problem;
+}
+
+
+int main() {
+
+    // fingerprints depend on structure only
+    std::vector<System::Constrain> rows = {{{1, 0, 2}, 3, Type::LE}, {{0, 4, 5}, 6, Type::GE}};
+    std::vector<System::Constrain> same = {{{-7, 0, 0.5}, -1, Type::LE}, {{0, 9, 1e-3}, 0, Type::GE}};
+    CHECK(fingerprint(rows) == fingerprint(same));
+    // and tell apart every change of structure, including nonzeros moved from a row to the next
+    std::vector<std::vector<System::Constrain>> others = {
+        {{{1, 0, 2}, 3, Type::LE}, {{0, 4, 5}, 6, Type::LE}},
+        {{{1, 0, 2}, 3, Type::LE}, {{4, 0, 5}, 6, Type::GE}},
+        {{{1, 0, 2}, 3, Type::LE}, {{0, 4, 5}, 6, Type::GE}, {{0, 4, 5}, 6, Type::GE}},
+        {{{1, 0, 2, 0}, 3, Type::LE}, {{0, 4, 5, 0}, 6, Type::GE}},
+        {{{1, 0, 0}, 3, Type::LE}, {{2, 4, 5}, 6, Type::GE}},
+        {{{1, 0, 2}, 3, Type::LE}, {{0, 4, 0}, 6, Type::GE}},
+        {{{0, 4, 5}, 6, Type::GE}, {{1, 0, 2}, 3, Type::LE}}};
+    for (size_t k = 0; k < others.size(); ++k) {
+        CHECK(fingerprint(others[k]) != fingerprint(rows));
+        for (size_t l = 0; l < k; ++l) {
+            CHECK(fingerprint(others[k]) != fingerprint(others[l]));
+        }
+    }
+    // rows of 2 and 1 nonzeros versus 1 and 2 nonzeros, with the same sequence of column indices
+    std::vector<System::Constrain> first = {{{1, 1}, 1, Type::LE}, {{0, 1}, 1, Type::LE}};
+    std::vector<System::Constrain> second = {{{1, 0}, 1, Type::LE}, {{1, 1}, 1, Type::LE}};
+    std::vector<System::Constrain> shifted = {{{1, 1}, 1, Type::LE}, {{0, 0}, 1, Type::LE}};
+    std::vector<System::Constrain> unshifted = {{{1, 0}, 1, Type::LE}, {{0, 1}, 1, Type::LE}};
+    CHECK(fingerprint(first) != fingerprint(second));
+    CHECK(fingerprint(shifted) != fingerprint(unshifted));
+
+    // least recently used bases are dropped first, finding a base makes it the most recently used
+    BasisCache<double> cache(2);
+    std::vector<size_t> base;
+    cache.store(1, {0, 1});
+    cache.store(2, {2, 3});
+    CHECK(cache.find(1, base) && base == std::vector<size_t>({0, 1}));
+    cache.store(3, {4, 5});
+    CHECK(cache.size() == 2);
+    CHECK(!cache.find(2, base));
+    CHECK(cache.find(1, base) && base == std::vector<size_t>({0, 1}));
+    CHECK(cache.find(3, base) && base == std::vector<size_t>({4, 5}));
+    // storing a fingerprint again replaces its base without dropping others
+    cache.store(1, {6, 7, 8});
+    CHECK(cache.size() == 2);
+    CHECK(cache.find(1, base) && base == std::vector<size_t>({6, 7, 8}));
+    CHECK(cache.find(3, base));
+    // successful finds are counted until the cache is cleared
+    CHECK(cache.hits() == 5);
+    cache.clear();
+    CHECK(cache.size() == 0 && !cache.find(1, base) && cache.hits() == 0);
+    BasisCache<double> disabled(0);
+    disabled.store(1, {0});
+    CHECK(disabled.size() == 0 && !disabled.find(1, base));
+
+    // warm starts: every problem is solved, then solved again with slightly different values
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(20, 25, 0.3, seed));
+    }
+    size_t cold_pivots = 0;
+    size_t warm_pivots = 0;
+    for (const auto& problem : problems) {
+        std::shared_ptr<BasisCache<double>> shared = std::make_shared<BasisCache<double>>();
+        check_cached(problem, shared);
+        // only optimal bases are stored
+        CHECK(shared->size() == (problem.expected == System::SolutionType::BOUNDED ? 1u : 0u));
+        for (double factor : {0.01, 0.05, 0.3}) {
+            TestUtils::Problem next = perturbed(problem, factor);
+            System cold;
+            TestUtils::load(cold, next);
+            std::vector<double> solution;
+            TestUtils::solve(cold, next, solution);
+            cold_pivots += cold.get_iterations();
+            warm_pivots += check_cached(next, shared);
+        }
+    }
+    std::cout << "Pivots from the starting base: " << cold_pivots << ", from cached bases: " << warm_pivots << std::endl;
+    CHECK(warm_pivots < cold_pivots);
+
+    // a feasible problem made infeasible keeps its fingerprint: the cached base must be rejected
+    TestUtils::Problem problem;
+    problem.name = "made_infeasible";
+    problem.constrains = {{{1, 1}, 3, Type::LE}, {{1, 1}, 2, Type::GE}};
+    problem.c = {1, 2};
+    problem.type = System::OptimizationType::MAX;
+    std::shared_ptr<BasisCache<double>> shared = std::make_shared<BasisCache<double>>();
+    check_cached(problem, shared);
+    problem.constrains[0].b = 1;
+    check_cached(problem, shared);
+
+    // bases stored by a colliding system are rejected or fixed by further pivots: wrong size, variables
+    // out of range, repeated variables, a singular base, then feasible bases that are not optimal
+    problem = problems[0];
+    uint64_t key = fingerprint(problem.constrains);
+    // variables 0..2 are decisional, 3..5 logical and 6..8 artificial
+    std::vector<std::vector<size_t>> collisions = {{0, 1}, {0, 1, 2, 3}, {0, 1, 99}, {0, 0, 1}, {3, 3, 3}, {0, 2, 1}, {3, 4, 5}};
+    for (const auto& collision : collisions) {
+        shared->store(key, collision);
+        check_cached(problem, shared);
+    }
+    // systems of different structures share a small cache
+    shared = std::make_shared<BasisCache<double>>(2);
+    for (size_t round = 0; round < 3; ++round) {
+        for (const auto& other : problems) {
+            check_cached(perturbed(other, 0.01 * static_cast<double>(round)), shared);
+        }
+    }
+
+    return TestUtils::report();
+}
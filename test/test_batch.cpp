@@ -0,0 +1,144 @@
+// Solutions of every lane of BatchLinearConstrainSystem compared with LinearConstrainSystem
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "../include/BatchLinearConstrainSystem.hpp"
+#include "TestUtils.hpp"
+
+
+const size_t K = 8;     //!< number of problems solved together
+typedef BatchLinearConstrainSystem<double, K> Batch;
+
+
+/**
+ * @brief method to solve K problems of the same shape with a batch, loaded by add_constrain or, if
+ * given, by set_constrain on an existing batch, and to compare every lane with LinearConstrainSystem
+ */
+void check_lanes(const std::array<TestUtils::Problem, K>& problems, Batch* reused = nullptr) {
+
+    const TestUtils::Problem& first = problems[0];
+    Batch batch(first.c.size());
+    Batch& system = reused ? *reused : batch;
+    for (size_t i = 0; i < first.constrains.size(); ++i) {
+        std::array<std::vector<double>, K> a;
+        std::array<double, K> b;
+        for (size_t lane = 0; lane < K; ++lane) {
+            a[lane] = problems[lane].constrains[i].a;
+            b[lane] = problems[lane].constrains[i].b;
+        }
+        if (reused) {
+            system.set_constrain(i, a, b);
+        } else {
+            system.add_constrain(a, b, first.constrains[i].type);
+        }
+    }
+    std::array<std::vector<double>, K> c;
+    for (size_t lane = 0; lane < K; ++lane) {
+        c[lane] = problems[lane].c;
+    }
+    std::array<std::vector<double>, K> solutions;
+    std::array<TestUtils::System::SolutionType, K> sol_types = system.optimize(solutions, c, first.type);
+
+    for (size_t lane = 0; lane < K; ++lane) {
+        std::vector<double> expected;
+        TestUtils::System::SolutionType reference = TestUtils::solve_reference(problems[lane], expected);
+        CHECK(sol_types[lane] == reference);
+        if (sol_types[lane] == reference && reference == TestUtils::System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(solutions[lane].back(), expected.back()));
+            CHECK(TestUtils::satisfies(problems[lane], solutions[lane]));
+        }
+    }
+}
+
+
+int main() {
+
+    typedef TestUtils::System System;
+
+    // lanes of every example: the example itself and copies with scaled constant terms and costs
+    for (const auto& problem : TestUtils::example_problems()) {
+        std::cout << "Problem " << problem.name << std::endl;
+        std::array<TestUtils::Problem, K> lanes;
+        for (size_t lane = 0; lane < K; ++lane) {
+            lanes[lane] = problem;
+            for (auto& constrain : lanes[lane].constrains) {
+                constrain.b *= 1 + 0.125 * lane;
+            }
+            for (auto& coefficient : lanes[lane].c) {
+                coefficient *= 1 + 0.25 * lane;
+            }
+        }
+        check_lanes(lanes);
+
+        // the example itself gives the expected result
+        Batch batch(problem.c.size());
+        for (const auto& constrain : problem.constrains) {
+            std::array<std::vector<double>, K> a;
+            std::array<double, K> b;
+            a.fill(constrain.a);
+            b.fill(constrain.b);
+            batch.add_constrain(a, b, constrain.type);
+        }
+        std::array<std::vector<double>, K> c;
+        c.fill(problem.c);
+        std::array<std::vector<double>, K> solutions;
+        std::array<System::SolutionType, K> sol_types = batch.optimize(solutions, c, problem.type);
+        CHECK(sol_types[0] == problem.expected);
+        if (sol_types[0] == System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(solutions[0].back(), problem.z));
+        }
+    }
+
+    // random problems of the same shape, whose lanes end bounded, unbounded or infeasible at different pivots
+    std::minstd_rand engine(7);
+    std::uniform_int_distribution<int> value(-5, 9);
+    std::uniform_int_distribution<int> type(0, 2);
+    for (size_t round = 0; round < 200; ++round) {
+        size_t rows = 1 + round % 5;
+        size_t columns = 2 + round % 3;
+        std::array<TestUtils::Problem, K> lanes;
+        std::vector<System::ConstrainType> types(rows);
+        for (auto& constrain_type : types) {
+            constrain_type = static_cast<System::ConstrainType>(type(engine));
+        }
+        for (size_t lane = 0; lane < K; ++lane) {
+            TestUtils::Problem& problem = lanes[lane];
+            problem.name = "random";
+            problem.constrains.resize(rows);
+            for (size_t i = 0; i < rows; ++i) {
+                problem.constrains[i].a.resize(columns);
+                for (auto& coefficient : problem.constrains[i].a) {
+                    coefficient = value(engine);
+                }
+                problem.constrains[i].b = value(engine);
+                problem.constrains[i].type = types[i];
+            }
+            problem.c.resize(columns);
+            for (auto& coefficient : problem.c) {
+                coefficient = value(engine);
+            }
+            problem.type = (round % 2 == 0) ? System::OptimizationType::MAX : System::OptimizationType::MIN;
+        }
+        check_lanes(lanes);
+        // the same problems loaded again through set_constrain on a used batch
+        if (round % 10 == 0) {
+            Batch reused(columns);
+            for (size_t i = 0; i < rows; ++i) {
+                std::array<std::vector<double>, K> a;
+                a.fill(std::vector<double>(columns, 1));
+                std::array<double, K> b;
+                b.fill(1);
+                reused.add_constrain(a, b, types[i]);
+            }
+            std::array<std::vector<double>, K> c;
+            c.fill(std::vector<double>(columns, 1));
+            std::array<std::vector<double>, K> solutions;
+            reused.optimize(solutions, c, System::OptimizationType::MAX);
+            check_lanes(lanes, &reused);
+        }
+    }
+
+    return TestUtils::report();
+}
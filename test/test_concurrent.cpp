@@ -0,0 +1,68 @@
+// optimize_concurrent compared with optimize, with and without exact verification
+
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+/**
+ * @brief method to race the pivot rules on a problem, reporting infeasibility as SolutionType::INFEASIBLE
+ */
+System::SolutionType solve_concurrent(System& system, const TestUtils::Problem& problem, std::vector<double>& solution) {
+    std::vector<System::PivotStrategy> strategies = {System::PivotStrategy(System::PivotRule::DANTZIG),
+                                                     System::PivotStrategy(System::PivotRule::BLAND),
+                                                     System::PivotStrategy(System::PivotRule::RANDOM, 1)};
+    try {
+        return system.optimize_concurrent(solution, problem.c, problem.type, strategies);
+    } catch (const InfeasibleSystemError&) {
+        return System::SolutionType::INFEASIBLE;
+    }
+}
+
+
+int main() {
+
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(15, 20, 0.3, seed));
+    }
+
+    for (const auto& problem : problems) {
+        std::vector<double> expected;
+        std::vector<double> solution;
+        System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+
+        System system;
+        TestUtils::load(system, problem);
+        System::SolutionType sol_type = solve_concurrent(system, problem, solution);
+        CHECK(sol_type == reference);
+        if (sol_type == System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(solution.back(), expected.back()));
+            CHECK(TestUtils::satisfies(problem, solution));
+            // the tableau of the winner is kept for post-optimal analysis
+            std::vector<std::pair<double, double>> ranges;
+            system.cost_ranging(ranges);
+            CHECK(ranges.size() == problem.c.size());
+        }
+
+        // with exact verification the result is the exact one rounded, as written by optimize
+        System verified;
+        verified.set_exact_verification(true);
+        TestUtils::load(verified, problem);
+        sol_type = solve_concurrent(verified, problem, solution);
+        System exact;
+        exact.set_exact_verification(true);
+        TestUtils::load(exact, problem);
+        std::vector<double> exact_solution;
+        CHECK(sol_type == TestUtils::solve(exact, problem, exact_solution));
+        CHECK(sol_type == reference);
+        if (sol_type == System::SolutionType::BOUNDED) {
+            CHECK(solution == exact_solution);
+        }
+    }
+
+    return TestUtils::report();
+}
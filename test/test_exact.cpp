@@ -0,0 +1,129 @@
+// Exact verification compared with LinearConstrainSystem: bases certified without pivots, bases
+// repaired by exact pivots, and exact solutions checked in rational arithmetic
+
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+/**
+ * @brief method to check that an exact solution satisfies the constrains of a problem exactly, and
+ * that its objective value equals the one of the dual values
+ */
+bool exact_optimum(const TestUtils::Problem& problem, const std::vector<Rational>& solution, const std::vector<Rational>& duals) {
+    Rational z;
+    for (size_t j = 0; j < problem.c.size(); ++j) {
+        if (solution[j] < Rational(0)) {
+            return false;
+        }
+        z += Rational(problem.c[j]) * solution[j];
+    }
+    Rational dual_z;
+    for (size_t i = 0; i < problem.constrains.size(); ++i) {
+        const auto& constrain = problem.constrains[i];
+        Rational value;
+        for (size_t j = 0; j < constrain.a.size(); ++j) {
+            value += Rational(constrain.a[j]) * solution[j];
+        }
+        Rational b(constrain.b);
+        if ((constrain.type != System::ConstrainType::GE && value > b) ||
+            (constrain.type != System::ConstrainType::LE && value < b)) {
+            return false;
+        }
+        dual_z += b * duals[i];
+    }
+    return z == solution.back() && dual_z == z;
+}
+
+
+/**
+ * @brief method to get a problem with the objective function of another problem of the same size
+ */
+TestUtils::Problem with_objective(TestUtils::Problem problem, const std::vector<double>& c) {
+    problem.c = c;
+    return problem;
+}
+
+
+int main() {
+
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(15, 20, 0.3, seed));
+    }
+
+    // the final base of the floating-point simplex is certified without pivots, also as proof of infeasibility
+    for (const auto& problem : problems) {
+        std::vector<double> expected;
+        std::vector<double> solution;
+        System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+        System system;
+        system.set_exact_verification(true);
+        TestUtils::load(system, problem);
+        CHECK(TestUtils::solve(system, problem, solution) == reference);
+        CHECK(system.get_exact_pivots() == 0);
+        if (reference == System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(solution, expected));
+            std::vector<Rational> exact_solution;
+            std::vector<Rational> exact_duals;
+            CHECK(system.verify_exact(exact_solution, exact_duals, problem.c, problem.type) == reference);
+            CHECK(exact_optimum(problem, exact_solution, exact_duals));
+            // the duals of the tableau rebuilt from the exact base
+            std::vector<double> duals;
+            system.get_duals(duals);
+            for (size_t i = 0; i < duals.size(); ++i) {
+                CHECK(TestUtils::near(duals[i], exact_duals[i].to_double()));
+            }
+        }
+    }
+
+    // a base optimal for another objective function is repaired by exact pivots
+    size_t repaired = 0;
+    for (const auto& problem : problems) {
+        System system;
+        TestUtils::load(system, problem);
+        std::vector<double> solution;
+        if (TestUtils::solve(system, problem, solution) != System::SolutionType::BOUNDED) {
+            continue;
+        }
+        std::vector<double> c(problem.c.rbegin(), problem.c.rend());
+        c[0] = -c[0];
+        TestUtils::Problem next = with_objective(problem, c);
+        std::vector<double> expected;
+        System::SolutionType reference = TestUtils::solve_reference(next, expected);
+        std::vector<Rational> exact_solution;
+        std::vector<Rational> exact_duals;
+        CHECK(system.verify_exact(exact_solution, exact_duals, c, next.type) == reference);
+        repaired += system.get_exact_pivots() > 0;
+        if (reference == System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(exact_solution.back().to_double(), expected.back()));
+            CHECK(exact_optimum(next, exact_solution, exact_duals));
+            // post-optimal analysis refers to the repaired base
+            std::vector<double> duals;
+            system.get_duals(duals);
+            for (size_t i = 0; i < duals.size(); ++i) {
+                CHECK(TestUtils::near(duals[i], exact_duals[i].to_double()));
+            }
+        } else {
+            CHECK(exact_solution.empty() && exact_duals.empty());
+        }
+    }
+    CHECK(repaired > 0);
+
+    // a feasible base of a system whose constant terms make it infeasible is repaired into a proof of infeasibility
+    TestUtils::Problem problem = problems[0];
+    System system;
+    TestUtils::load(system, problem);
+    std::vector<double> solution;
+    CHECK(TestUtils::solve(system, problem, solution) == System::SolutionType::BOUNDED);
+    problem.constrains[1].b = 100;
+    system.set_constrain(1, problem.constrains[1].a, problem.constrains[1].b, problem.constrains[1].type);
+    std::vector<Rational> exact_solution;
+    std::vector<Rational> exact_duals;
+    CHECK(system.verify_exact(exact_solution, exact_duals, problem.c, problem.type) == System::SolutionType::INFEASIBLE);
+
+    return TestUtils::report();
+}
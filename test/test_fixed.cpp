@@ -0,0 +1,133 @@
+// Solutions of FixedLinearConstrainSystem compared with LinearConstrainSystem, and optimizations
+// through its std::vector overloads without allocations
+
+#include <array>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "../include/FixedLinearConstrainSystem.hpp"
+#include "TestUtils.hpp"
+
+
+static size_t allocations = 0;    //!< number of calls to operator new so far
+
+void* operator new(size_t size) {
+    allocations++;
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+
+/**
+ * @brief method to solve a problem with N decisional variables by FixedLinearConstrainSystem<double, M, N>,
+ * reporting infeasibility as SolutionType::INFEASIBLE
+ */
+template<size_t M, size_t N>
+TestUtils::System::SolutionType solve_fixed(const TestUtils::Problem& problem, std::vector<double>& solution) {
+
+    FixedLinearConstrainSystem<double, M, N> system;
+    for (size_t i = 0; i < problem.constrains.size(); ++i) {
+        const auto& constrain = problem.constrains[i];
+        // rows added by both overloads
+        if (i % 2 == 0) {
+            system.add_constrain(constrain.a, constrain.b, constrain.type);
+        } else {
+            std::array<double, N> a;
+            std::copy(constrain.a.begin(), constrain.a.end(), a.begin());
+            system.add_constrain(a, constrain.b, constrain.type);
+        }
+    }
+    try {
+        return system.optimize(solution, problem.c, problem.type);
+    } catch (const InfeasibleSystemError&) {
+        return TestUtils::System::SolutionType::INFEASIBLE;
+    }
+}
+
+
+int main() {
+
+    for (const auto& problem : TestUtils::example_problems()) {
+        std::cout << "Problem " << problem.name << std::endl;
+        std::vector<double> expected;
+        std::vector<double> solution;
+        TestUtils::System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+        // rows of constrains not added are the trivial constrain 0 <= 0: M is larger than needed
+        TestUtils::System::SolutionType sol_type = (problem.c.size() == 3) ? solve_fixed<6, 3>(problem, solution)
+                                                                           : solve_fixed<6, 2>(problem, solution);
+        CHECK(reference == problem.expected);
+        CHECK(sol_type == problem.expected);
+        if (sol_type == TestUtils::System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(solution.back(), problem.z));
+            CHECK(TestUtils::near(solution.back(), expected.back()));
+            CHECK(TestUtils::satisfies(problem, solution));
+        }
+    }
+
+    // more constrains than M are rejected
+    FixedLinearConstrainSystem<double, 1, 2> small;
+    small.add_constrain({1, 1}, 1, TestUtils::System::ConstrainType::LE);
+    bool rejected = false;
+    try {
+        small.add_constrain({1, 0}, 1, TestUtils::System::ConstrainType::LE);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+    // rows of the wrong size are rejected
+    FixedLinearConstrainSystem<double, 2, 2> sized;
+    rejected = false;
+    try {
+        sized.add_constrain(std::vector<double>({1, 1, 1}), 1, TestUtils::System::ConstrainType::LE);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+
+    // systems built and optimized through the std::vector overloads allocate only for the first
+    // solution vector, the rows of the problems are allocated beforehand
+    std::vector<TestUtils::Problem> problems;
+    for (const auto& problem : TestUtils::example_problems()) {
+        if (problem.c.size() == 2 && problem.expected == TestUtils::System::SolutionType::BOUNDED) {
+            problems.push_back(problem);
+        }
+    }
+    std::vector<double> steady_solution;
+    steady_solution.reserve(3);
+    size_t before = allocations;
+    for (size_t round = 0; round < 100; ++round) {
+        const TestUtils::Problem& problem = problems[round % problems.size()];
+        FixedLinearConstrainSystem<double, 6, 2> system;
+        for (const auto& constrain : problem.constrains) {
+            system.add_constrain(constrain.a, constrain.b, constrain.type);
+        }
+        CHECK(system.optimize(steady_solution, problem.c, problem.type) == TestUtils::System::SolutionType::BOUNDED);
+        CHECK(TestUtils::near(steady_solution.back(), problem.z));
+    }
+    std::cout << "Allocations of the std::vector overloads: " << allocations - before << std::endl;
+    CHECK(allocations == before);
+
+    // a copy is solved independently of the original
+    FixedLinearConstrainSystem<double, 2, 2> original;
+    original.add_constrain({1, 0}, 3, TestUtils::System::ConstrainType::LE);
+    FixedLinearConstrainSystem<double, 2, 2> copy = original;
+    copy.add_constrain({0, 1}, 4, TestUtils::System::ConstrainType::LE);
+    std::array<double, 3> solution;
+    CHECK(copy.optimize(solution, {1, 1}, TestUtils::System::OptimizationType::MAX) == TestUtils::System::SolutionType::BOUNDED);
+    CHECK(TestUtils::near(solution[2], 7));
+    CHECK(original.optimize(solution, {1, 1}, TestUtils::System::OptimizationType::MAX) == TestUtils::System::SolutionType::UNBOUNDED);
+
+    return TestUtils::report();
+}
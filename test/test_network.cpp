@@ -0,0 +1,182 @@
+// Network simplex compared with the tableau, and post-optimal analysis after both of them
+
+#include <random>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+/**
+ * @brief method to generate a transportation problem with the given supplies and demands: a LE row
+ * for every source and a GE row for every destination, minimizing the cost of shipments
+ */
+TestUtils::Problem transportation(const std::vector<double>& supplies, const std::vector<double>& demands,
+                                  const std::vector<double>& costs) {
+
+    size_t sources = supplies.size();
+    size_t destinations = demands.size();
+    TestUtils::Problem problem;
+    problem.name = "transportation";
+    problem.constrains.resize(sources + destinations);
+    for (size_t i = 0; i < sources + destinations; ++i) {
+        problem.constrains[i].a.assign(sources * destinations, 0);
+    }
+    for (size_t i = 0; i < sources; ++i) {
+        for (size_t j = 0; j < destinations; ++j) {
+            problem.constrains[i].a[i * destinations + j] = 1;
+            problem.constrains[sources + j].a[i * destinations + j] = 1;
+        }
+        problem.constrains[i].b = supplies[i];
+        problem.constrains[i].type = System::ConstrainType::LE;
+    }
+    for (size_t j = 0; j < destinations; ++j) {
+        problem.constrains[sources + j].b = demands[j];
+        problem.constrains[sources + j].type = System::ConstrainType::GE;
+    }
+    problem.c = costs;
+    problem.type = System::OptimizationType::MIN;
+    problem.expected = System::SolutionType::BOUNDED;
+    problem.z = 0;
+    return problem;
+}
+
+
+/**
+ * @brief method to compare two vectors of ranges
+ */
+bool near(const std::vector<std::pair<double, double>>& ranges, const std::vector<std::pair<double, double>>& expected) {
+    if (ranges.size() != expected.size()) {
+        return false;
+    }
+    for (size_t j = 0; j < ranges.size(); ++j) {
+        // infinite bounds must match exactly
+        if ((ranges[j].first != expected[j].first && !TestUtils::near(ranges[j].first, expected[j].first)) ||
+            (ranges[j].second != expected[j].second && !TestUtils::near(ranges[j].second, expected[j].second))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+int main() {
+
+    // 2 sources and 2 destinations with a non degenerate optimum, z = 4*20 + 5*5 + 3*25
+    TestUtils::Problem problem = transportation({20, 40}, {25, 25}, {4, 6, 5, 3});
+    std::vector<double> expected;
+    std::vector<double> solution;
+
+    // network detection is disabled by default: the tableau is optimal after optimize
+    System tableau_system;
+    TestUtils::load(tableau_system, problem);
+    CHECK(TestUtils::solve(tableau_system, problem, expected) == System::SolutionType::BOUNDED);
+    CHECK(TestUtils::near(expected.back(), 180));
+    std::vector<std::pair<double, double>> expected_cost_ranges;
+    std::vector<std::pair<double, double>> expected_rhs_ranges;
+    std::vector<double> expected_duals;
+    tableau_system.cost_ranging(expected_cost_ranges);
+    tableau_system.rhs_ranging(expected_rhs_ranges);
+    tableau_system.get_duals(expected_duals);
+
+    // the network simplex gives the same optimum, and the tableau is built from its spanning tree
+    System network_system;
+    network_system.set_network_detection(true);
+    TestUtils::load(network_system, problem);
+    CHECK(TestUtils::solve(network_system, problem, solution) == System::SolutionType::BOUNDED);
+    CHECK(TestUtils::near(solution, expected));
+    std::vector<std::pair<double, double>> ranges;
+    std::vector<double> duals;
+    network_system.get_duals(duals);
+    CHECK(TestUtils::near(duals, expected_duals));
+    bool available = true;
+    try {
+        network_system.cost_ranging(ranges);
+        CHECK(near(ranges, expected_cost_ranges));
+        network_system.rhs_ranging(ranges);
+        CHECK(near(ranges, expected_rhs_ranges));
+    } catch (const std::logic_error&) {
+        available = false;
+    }
+    CHECK(available);
+    network_system.get_duals(duals);
+    CHECK(TestUtils::near(duals, expected_duals));
+
+    // random transportation problems, balanced or not, and assignment problems, which are degenerate
+    std::minstd_rand engine(7);
+    std::uniform_int_distribution<int> amount(1, 50);
+    std::uniform_int_distribution<int> cost(1, 20);
+    for (size_t round = 0; round < 100; ++round) {
+        size_t sources = 1 + round % 6;
+        size_t destinations = 1 + (round / 6) % 7;
+        bool assignment = (round % 4 == 3);
+        std::vector<double> supplies(sources);
+        std::vector<double> demands(destinations);
+        std::vector<double> costs(sources * destinations);
+        for (auto& value : supplies) {
+            value = assignment ? 1 : amount(engine);
+        }
+        for (auto& value : demands) {
+            value = assignment ? 1 : amount(engine);
+        }
+        for (auto& value : costs) {
+            value = cost(engine);
+        }
+        problem = transportation(supplies, demands, costs);
+        System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+        System system;
+        system.set_network_detection(true);
+        TestUtils::load(system, problem);
+        System::SolutionType sol_type = TestUtils::solve(system, problem, solution);
+        CHECK(sol_type == reference);
+        if (sol_type == System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(solution.back(), expected.back()));
+            CHECK(TestUtils::satisfies(problem, solution));
+            // the rebuilt tableau is optimal for the same objective value
+            std::vector<double> rhs_direction(problem.constrains.size(), 0);
+            std::vector<std::pair<double, double>> breakpoints;
+            CHECK(system.parametric_rhs(rhs_direction, 1, breakpoints) == System::SolutionType::BOUNDED);
+            CHECK(!breakpoints.empty() && TestUtils::near(breakpoints.front().second, expected.back()));
+        }
+    }
+
+    // min cost flow on random graphs, whose spanning trees are deeper than the ones of transportation
+    // problems: a ring of arcs keeps every graph connected and the supplies sum to 0
+    std::uniform_int_distribution<size_t> node(0, 29);
+    std::uniform_int_distribution<int> supply(-20, 20);
+    for (size_t round = 0; round < 20; ++round) {
+        size_t nodes = 30;
+        size_t arcs = 90;
+        problem.name = "min_cost_flow";
+        problem.constrains.assign(nodes, System::Constrain(std::vector<double>(arcs, 0), 0, System::ConstrainType::EQ));
+        problem.c.resize(arcs);
+        for (size_t j = 0; j < arcs; ++j) {
+            size_t tail = (j < nodes) ? j : node(engine);
+            size_t head = (j < nodes) ? (j + 1) % nodes : node(engine);
+            if (head == tail) {
+                head = (tail + 1) % nodes;
+            }
+            problem.constrains[tail].a[j] = 1;
+            problem.constrains[head].a[j] = -1;
+            problem.c[j] = cost(engine);
+        }
+        double total = 0;
+        for (size_t i = 0; i + 1 < nodes; ++i) {
+            problem.constrains[i].b = supply(engine);
+            total += problem.constrains[i].b;
+        }
+        problem.constrains[nodes - 1].b = -total;
+        System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+        System system;
+        system.set_network_detection(true);
+        TestUtils::load(system, problem);
+        CHECK(reference == System::SolutionType::BOUNDED);
+        CHECK(TestUtils::solve(system, problem, solution) == reference);
+        CHECK(TestUtils::near(solution.back(), expected.back()));
+        CHECK(TestUtils::satisfies(problem, solution));
+    }
+
+    return TestUtils::report();
+}
@@ -0,0 +1,114 @@
+// Initial tableaus written by several threads compared with tableaus written by one, on problems
+// mixing LE, GE and EQ rows with positive and negative constant terms
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+/**
+ * @brief method to generate a random problem with LE, GE and EQ rows, feasible at a random point,
+ * whose constant terms take both signs; minimizing positive costs keeps it bounded
+ */
+TestUtils::Problem mixed_problem(size_t rows, size_t columns, unsigned seed) {
+    std::minstd_rand engine(seed);
+    std::uniform_real_distribution<double> value(-5, 10);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::vector<double> point(columns);
+    for (auto& x : point) {
+        x = uniform(engine) < 0.5 ? 0 : 5 * uniform(engine);
+    }
+    TestUtils::Problem problem;
+    problem.name = "mixed_" + std::to_string(seed);
+    problem.constrains.resize(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        auto& constrain = problem.constrains[i];
+        constrain.a.assign(columns, 0);
+        double activity = 0;
+        for (size_t j = 0; j < columns; ++j) {
+            if (uniform(engine) < 0.3 || j % rows == i) {
+                constrain.a[j] = value(engine);
+                activity += constrain.a[j] * point[j];
+            }
+        }
+        double kind = uniform(engine);
+        if (kind < 0.3) {
+            constrain.type = System::ConstrainType::EQ;
+            constrain.b = activity;
+        } else if (kind < 0.65) {
+            constrain.type = System::ConstrainType::LE;
+            constrain.b = activity + 3 * uniform(engine);
+        } else {
+            constrain.type = System::ConstrainType::GE;
+            constrain.b = activity - 3 * uniform(engine);
+        }
+    }
+    problem.c.resize(columns);
+    for (auto& coefficient : problem.c) {
+        coefficient = 1 + 9 * uniform(engine);
+    }
+    problem.type = System::OptimizationType::MIN;
+    problem.expected = System::SolutionType::BOUNDED;
+    problem.z = 0;
+    return problem;
+}
+
+
+/**
+ * @brief method to solve a problem writing the initial tableau with the given threshold
+ */
+System::SolutionType solve(const TestUtils::Problem& problem, size_t threshold, std::vector<double>& solution, std::vector<double>& duals) {
+    System system;
+    system.set_parallel_rows_threshold(threshold);
+    TestUtils::load(system, problem);
+    System::SolutionType sol_type = TestUtils::solve(system, problem, solution);
+    if (sol_type == System::SolutionType::BOUNDED) {
+        system.get_duals(duals);
+    }
+    return sol_type;
+}
+
+
+int main() {
+
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        problems.push_back(mixed_problem(10 + 13 * seed, 20 + 7 * seed, seed));
+    }
+
+    // threshold 0 writes rows with several threads, even fewer rows than threads; the largest size_t never
+    const size_t serial = std::numeric_limits<size_t>::max();
+    size_t mixed_signs = 0;
+    for (const auto& problem : problems) {
+        std::cout << "Problem " << problem.name << std::endl;
+        bool negative = false;
+        bool positive = false;
+        for (const auto& constrain : problem.constrains) {
+            negative = negative || (constrain.type != System::ConstrainType::EQ && constrain.b < 0);
+            positive = positive || (constrain.type != System::ConstrainType::EQ && constrain.b > 0);
+        }
+        mixed_signs += negative && positive;
+        std::vector<double> expected;
+        std::vector<double> expected_duals;
+        std::vector<double> solution;
+        std::vector<double> duals;
+        System::SolutionType reference = solve(problem, serial, expected, expected_duals);
+        CHECK(solve(problem, 0, solution, duals) == reference);
+        CHECK(reference == problem.expected);
+        if (reference == System::SolutionType::BOUNDED) {
+            // the same tableau, hence the same pivots
+            CHECK(solution == expected);
+            CHECK(duals == expected_duals);
+            CHECK(TestUtils::satisfies(problem, solution));
+        }
+    }
+    // problems mixing rows kept as they are and rows multiplied by -1 inside the tableau
+    CHECK(mixed_signs > 0);
+
+    return TestUtils::report();
+}
@@ -0,0 +1,242 @@
+// Post-optimal analysis compared with optimizations from scratch: the ranges of cost_ranging and
+// rhs_ranging, and the breakpoints of parametric_rhs and parametric_cost, at sampled points
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+/**
+ * @brief method to generate a random problem with LE, GE and EQ rows, feasible at a random point;
+ * minimizing positive costs keeps it bounded
+ */
+TestUtils::Problem mixed_problem(size_t rows, size_t columns, unsigned seed) {
+    std::minstd_rand engine(seed);
+    std::uniform_real_distribution<double> value(-5, 10);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::vector<double> point(columns);
+    for (auto& x : point) {
+        x = uniform(engine) < 0.5 ? 0 : 5 * uniform(engine);
+    }
+    TestUtils::Problem problem;
+    problem.name = "mixed_" + std::to_string(seed);
+    problem.constrains.resize(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        auto& constrain = problem.constrains[i];
+        constrain.a.assign(columns, 0);
+        double activity = 0;
+        for (size_t j = 0; j < columns; ++j) {
+            if (uniform(engine) < 0.5 || j % rows == i) {
+                constrain.a[j] = value(engine);
+                activity += constrain.a[j] * point[j];
+            }
+        }
+        double kind = uniform(engine);
+        if (kind < 0.3) {
+            constrain.type = System::ConstrainType::EQ;
+            constrain.b = activity;
+        } else if (kind < 0.65) {
+            constrain.type = System::ConstrainType::LE;
+            constrain.b = activity + 3 * uniform(engine);
+        } else {
+            constrain.type = System::ConstrainType::GE;
+            constrain.b = activity - 3 * uniform(engine);
+        }
+    }
+    problem.c.resize(columns);
+    for (auto& coefficient : problem.c) {
+        coefficient = 1 + 9 * uniform(engine);
+    }
+    problem.type = System::OptimizationType::MIN;
+    problem.expected = System::SolutionType::BOUNDED;
+    problem.z = 0;
+    return problem;
+}
+
+
+/**
+ * @brief method to get the optimal value of a problem solved from scratch
+ */
+System::SolutionType cold_solve(const TestUtils::Problem& problem, double& z) {
+    std::vector<double> solution;
+    System::SolutionType sol_type = TestUtils::solve_reference(problem, solution);
+    z = (sol_type == System::SolutionType::BOUNDED) ? solution.back() : 0;
+    return sol_type;
+}
+
+
+/**
+ * @brief method to get points strictly inside a range around a value, also when its bounds are infinite
+ */
+std::vector<double> inside(double value, const std::pair<double, double>& range) {
+    std::vector<double> points;
+    double lower = std::isinf(range.first) ? value - 10 * (1 + std::fabs(value)) : range.first;
+    double upper = std::isinf(range.second) ? value + 10 * (1 + std::fabs(value)) : range.second;
+    points.push_back(value + 0.5 * (lower - value));
+    points.push_back(value + 0.5 * (upper - value));
+    return points;
+}
+
+
+/**
+ * @brief method to get z(t) on the piecewise linear function through the breakpoints
+ */
+double interpolate(const std::vector<std::pair<double, double>>& breakpoints, double t) {
+    size_t k = 1;
+    while (k + 1 < breakpoints.size() && breakpoints[k].first < t) {
+        ++k;
+    }
+    const auto& left = breakpoints[k - 1];
+    const auto& right = breakpoints[k];
+    return left.second + (right.second - left.second) * (t - left.first) / (right.first - left.first);
+}
+
+
+/**
+ * @brief method to get the values of t where a sweep is sampled: breakpoints and the points between them
+ */
+std::vector<double> samples(const std::vector<std::pair<double, double>>& breakpoints) {
+    std::vector<double> points;
+    for (size_t k = 0; k < breakpoints.size(); ++k) {
+        points.push_back(breakpoints[k].first);
+        if (k + 1 < breakpoints.size()) {
+            points.push_back(0.5 * (breakpoints[k].first + breakpoints[k + 1].first));
+        }
+    }
+    return points;
+}
+
+
+/**
+ * @brief method to check every post-optimal method of a bounded problem against optimizations from scratch
+ */
+void check_postoptimal(const TestUtils::Problem& problem, std::minstd_rand& engine) {
+
+    System system;
+    TestUtils::load(system, problem);
+    std::vector<double> solution;
+    if (TestUtils::solve(system, problem, solution) != System::SolutionType::BOUNDED) {
+        return;
+    }
+    double z = solution.back();
+    double cold_z;
+
+    // inside its range a cost leaves the solution optimal
+    std::vector<std::pair<double, double>> ranges;
+    system.cost_ranging(ranges);
+    for (size_t j = 0; j < problem.c.size(); ++j) {
+        for (double coefficient : inside(problem.c[j], ranges[j])) {
+            TestUtils::Problem changed = problem;
+            changed.c[j] = coefficient;
+            CHECK(cold_solve(changed, cold_z) == System::SolutionType::BOUNDED);
+            CHECK(TestUtils::near(cold_z, z + (coefficient - problem.c[j]) * solution[j], 1e-6));
+        }
+    }
+
+    // inside its range a constant term changes z by its dual value
+    std::vector<double> duals;
+    system.get_duals(duals);
+    system.rhs_ranging(ranges);
+    for (size_t i = 0; i < problem.constrains.size(); ++i) {
+        for (double b : inside(problem.constrains[i].b, ranges[i])) {
+            TestUtils::Problem changed = problem;
+            changed.constrains[i].b = b;
+            CHECK(cold_solve(changed, cold_z) == System::SolutionType::BOUNDED);
+            CHECK(TestUtils::near(cold_z, z + (b - problem.constrains[i].b) * duals[i], 1e-6));
+        }
+    }
+
+    std::uniform_real_distribution<double> value(-3, 3);
+    for (size_t round = 0; round < 3; ++round) {
+        // z(t) of constant terms b + t*direction, infeasible just past the last breakpoint if the sweep stops
+        std::vector<double> direction(problem.constrains.size());
+        for (auto& element : direction) {
+            element = value(engine);
+        }
+        std::vector<std::pair<double, double>> breakpoints;
+        System::SolutionType sweep = system.parametric_rhs(direction, 5, breakpoints);
+        CHECK(breakpoints.size() >= 2 || sweep == System::SolutionType::INFEASIBLE);
+        CHECK(sweep == System::SolutionType::INFEASIBLE || breakpoints.back().first == 5);
+        TestUtils::Problem changed = problem;
+        for (double t : samples(breakpoints)) {
+            for (size_t i = 0; i < problem.constrains.size(); ++i) {
+                changed.constrains[i].b = problem.constrains[i].b + t * direction[i];
+            }
+            CHECK(cold_solve(changed, cold_z) == System::SolutionType::BOUNDED);
+            if (breakpoints.size() >= 2) {
+                CHECK(TestUtils::near(cold_z, interpolate(breakpoints, t), 1e-6));
+            }
+        }
+        if (sweep == System::SolutionType::INFEASIBLE) {
+            double t = breakpoints.back().first + 1e-3;
+            for (size_t i = 0; i < problem.constrains.size(); ++i) {
+                changed.constrains[i].b = problem.constrains[i].b + t * direction[i];
+            }
+            CHECK(cold_solve(changed, cold_z) == System::SolutionType::INFEASIBLE);
+        }
+
+        // z(t) of costs c + t*direction, unbounded just past the last breakpoint if the sweep stops
+        direction.resize(problem.c.size());
+        for (auto& element : direction) {
+            element = value(engine);
+        }
+        sweep = system.parametric_cost(direction, 5, breakpoints);
+        CHECK(breakpoints.size() >= 2);
+        CHECK(sweep == System::SolutionType::UNBOUNDED || breakpoints.back().first == 5);
+        changed = problem;
+        for (double t : samples(breakpoints)) {
+            for (size_t j = 0; j < problem.c.size(); ++j) {
+                changed.c[j] = problem.c[j] + t * direction[j];
+            }
+            CHECK(cold_solve(changed, cold_z) == System::SolutionType::BOUNDED);
+            CHECK(TestUtils::near(cold_z, interpolate(breakpoints, t), 1e-6));
+        }
+        if (sweep == System::SolutionType::UNBOUNDED) {
+            double t = breakpoints.back().first + 1e-3;
+            for (size_t j = 0; j < problem.c.size(); ++j) {
+                changed.c[j] = problem.c[j] + t * direction[j];
+            }
+            CHECK(cold_solve(changed, cold_z) == System::SolutionType::UNBOUNDED);
+        }
+    }
+}
+
+
+int main() {
+
+    // an artificial variable at 0 leaves the base in place of a column with an M cost:
+    // max -3x1 with -2x1 = -3t is feasible for every t >= 0, with z = -4.5t
+    TestUtils::Problem problem;
+    problem.name = "artificial_leaving";
+    problem.constrains = {{{-2}, 0, System::ConstrainType::EQ}};
+    problem.c = {-3};
+    problem.type = System::OptimizationType::MAX;
+    problem.expected = System::SolutionType::BOUNDED;
+    problem.z = 0;
+    System system;
+    TestUtils::load(system, problem);
+    std::vector<double> solution;
+    CHECK(TestUtils::solve(system, problem, solution) == System::SolutionType::BOUNDED);
+    std::vector<std::pair<double, double>> breakpoints;
+    CHECK(system.parametric_rhs({-3}, 5, breakpoints) == System::SolutionType::BOUNDED);
+    CHECK(breakpoints.size() >= 2 && breakpoints.back().first == 5 && TestUtils::near(breakpoints.back().second, -22.5));
+
+    std::minstd_rand engine(5);
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(8, 10, 0.4, seed));
+    }
+    for (unsigned seed = 1; seed <= 40; ++seed) {
+        problems.push_back(mixed_problem(3 + seed % 5, 4 + seed % 4, seed));
+    }
+    for (const auto& next : problems) {
+        check_postoptimal(next, engine);
+    }
+
+    return TestUtils::report();
+}
@@ -0,0 +1,297 @@
+// Messages of SimplexProtocol encoded and decoded back, malformed ones rejected, and requests
+// solved by SimplexServer for SimplexClient compared with LinearConstrainSystem
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/SimplexClient.hpp"
+#include "../include/SimplexServer.hpp"
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+/**
+ * @brief method to build the request of a problem
+ */
+SimplexProtocol::Request make_request(const TestUtils::Problem& problem, uint64_t id) {
+    SimplexProtocol::Request request;
+    request.id = id;
+    request.type = problem.type;
+    request.num_variables = problem.c.size();
+    request.constrains = problem.constrains;
+    request.c = problem.c;
+    return request;
+}
+
+
+/**
+ * @brief method to compare two requests field by field
+ */
+bool equal(const SimplexProtocol::Request& request, const SimplexProtocol::Request& expected) {
+    if (request.id != expected.id || request.type != expected.type || request.num_variables != expected.num_variables ||
+        request.constrains.size() != expected.constrains.size() || request.c != expected.c) {
+        return false;
+    }
+    for (size_t i = 0; i < request.constrains.size(); ++i) {
+        if (request.constrains[i].a != expected.constrains[i].a || request.constrains[i].b != expected.constrains[i].b ||
+            request.constrains[i].type != expected.constrains[i].type) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief method to check that decoding a message throws std::runtime_error
+ */
+template<typename Message>
+bool rejected(const std::vector<char>& message) {
+    Message decoded;
+    try {
+        SimplexProtocol::decode(message, decoded);
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+
+/**
+ * @brief method to check that every message shorter than a valid one is rejected
+ */
+template<typename Message>
+bool prefixes_rejected(const std::vector<char>& message) {
+    for (size_t size = 0; size < message.size(); ++size) {
+        if (!rejected<Message>(std::vector<char>(message.begin(), message.begin() + size))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+int main() {
+
+    std::vector<char> message;
+
+    // requests: every constrain type, negative constant terms, zero coefficients and both optimization types
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    problems.push_back(TestUtils::random_problem(10, 12, 0.2, 3));
+    SimplexProtocol::Request decoded;
+    for (size_t k = 0; k < problems.size(); ++k) {
+        SimplexProtocol::Request request = make_request(problems[k], 1000 + k);
+        SimplexProtocol::encode(request, message);
+        // decoded is reused, as by the server, also when the next request is smaller
+        SimplexProtocol::decode(message, decoded);
+        CHECK(equal(decoded, request));
+        CHECK(prefixes_rejected<SimplexProtocol::Request>(message));
+    }
+
+    // requests whose constrains or objective function do not match the number of variables are not encoded
+    SimplexProtocol::Request request = make_request(problems[0], 1);
+    request.c.pop_back();
+    bool invalid = false;
+    try {
+        SimplexProtocol::encode(request, message);
+    } catch (const std::invalid_argument&) {
+        invalid = true;
+    }
+    CHECK(invalid);
+
+    // malformed requests; offsets follow the layout of SimplexProtocol: the first constrain starts at byte 21
+    request = make_request(problems[0], 1);
+    SimplexProtocol::encode(request, message);
+    std::vector<char> malformed = message;
+    malformed[0] ^= 1;
+    CHECK(rejected<SimplexProtocol::Request>(malformed));
+    malformed = message;
+    malformed[21] = 3;
+    CHECK(rejected<SimplexProtocol::Request>(malformed));
+    malformed = message;
+    // index of the first nonzero coefficient of the first constrain
+    uint32_t index = 3;
+    std::memcpy(malformed.data() + 21 + 1 + 8 + 4, &index, sizeof(index));
+    CHECK(rejected<SimplexProtocol::Request>(malformed));
+    malformed = message;
+    // a count of constrains larger than the message can hold
+    uint32_t count = 1u << 31;
+    std::memcpy(malformed.data() + 13, &count, sizeof(count));
+    CHECK(rejected<SimplexProtocol::Request>(malformed));
+    // empty constrains, each expanded to num_variables coefficients: rejected before the expansion when
+    // the objective function does not fit in the message, or when there are too many coefficients
+    for (uint32_t variables : {30000u, 16384u}) {
+        uint32_t constrains = 16384;
+        std::vector<char> header;
+        SimplexProtocol::encode(SimplexProtocol::Request(), header);
+        malformed.assign(header.begin(), header.end());
+        std::memcpy(malformed.data() + 13, &constrains, sizeof(constrains));
+        std::memcpy(malformed.data() + 17, &variables, sizeof(variables));
+        for (uint32_t i = 0; i < constrains; ++i) {
+            SimplexProtocol::put(malformed, static_cast<uint8_t>(System::ConstrainType::LE));
+            SimplexProtocol::put(malformed, 1.0);
+            SimplexProtocol::put(malformed, static_cast<uint32_t>(0));
+        }
+        if (variables == 16384) {
+            malformed.resize(malformed.size() + variables * sizeof(double));
+        }
+        CHECK(rejected<SimplexProtocol::Request>(malformed));
+    }
+    // and not encoded, whatever the size of the constrains
+    request = SimplexProtocol::Request();
+    request.num_variables = 16384;
+    request.constrains.resize(16384);
+    invalid = false;
+    try {
+        SimplexProtocol::encode(request, message);
+    } catch (const std::invalid_argument&) {
+        invalid = true;
+    }
+    CHECK(invalid);
+
+    // responses of every status
+    std::vector<SimplexProtocol::Response> responses(4);
+    responses[0].id = 7;
+    responses[0].status = static_cast<uint8_t>(System::SolutionType::BOUNDED);
+    responses[0].solution = {1.5, -0.25, 3, 1e300, 12};
+    responses[1].id = 8;
+    responses[1].status = static_cast<uint8_t>(System::SolutionType::INFEASIBLE);
+    responses[2].id = 9;
+    responses[2].status = SimplexProtocol::ERROR;
+    responses[2].error = "Variable index out of range";
+    responses[3].id = 10;
+    responses[3].status = SimplexProtocol::ERROR;
+    SimplexProtocol::Response response;
+    for (const auto& expected : responses) {
+        SimplexProtocol::encode(expected, message);
+        SimplexProtocol::decode(message, response);
+        CHECK(response.id == expected.id && response.status == expected.status);
+        CHECK(response.solution == expected.solution && response.error == expected.error);
+        CHECK(prefixes_rejected<SimplexProtocol::Response>(message));
+    }
+    SimplexProtocol::encode(responses[0], message);
+    message[3] ^= 1;
+    CHECK(rejected<SimplexProtocol::Response>(message));
+
+    #ifdef SIMPLEX_HAS_UNIX_SOCKETS
+    // frames: an empty message and a message, then a frame too large and a frame cut by the connection
+    int sockets[2];
+    CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+    SimplexProtocol::encode(responses[2], message);
+    SimplexProtocol::write_frame(sockets[0], std::vector<char>());
+    SimplexProtocol::write_frame(sockets[0], message);
+    std::vector<char> received(3, 'x');
+    CHECK(SimplexProtocol::read_frame(sockets[1], received) && received.empty());
+    CHECK(SimplexProtocol::read_frame(sockets[1], received) && received == message);
+    uint32_t size = SimplexProtocol::MAX_FRAME_SIZE + 1;
+    CHECK(::send(sockets[0], &size, sizeof(size), 0) == static_cast<ssize_t>(sizeof(size)));
+    bool too_large = false;
+    try {
+        SimplexProtocol::read_frame(sockets[1], received);
+    } catch (const std::runtime_error&) {
+        too_large = true;
+    }
+    CHECK(too_large);
+    size = 100;
+    CHECK(::send(sockets[0], &size, sizeof(size), 0) == static_cast<ssize_t>(sizeof(size)));
+    CHECK(::send(sockets[0], message.data(), 10, 0) == 10);
+    ::close(sockets[0]);
+    bool cut = false;
+    try {
+        SimplexProtocol::read_frame(sockets[1], received);
+    } catch (const std::runtime_error&) {
+        cut = true;
+    }
+    CHECK(cut);
+    ::close(sockets[1]);
+
+    // a connection closed between two frames ends without errors
+    CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+    ::close(sockets[0]);
+    CHECK(!SimplexProtocol::read_frame(sockets[1], received));
+    ::close(sockets[1]);
+
+    // client and server: the examples, sent one at a time and then all together; optimize prints
+    // every problem, so the output is discarded while the server runs
+    std::string path = "/tmp/simplex_test_" + std::to_string(::getpid()) + ".sock";
+    std::cout.setstate(std::ios::failbit);
+    {
+        SimplexServer server(path, 2, 4);
+        std::thread acceptor(&SimplexServer::run, &server);
+        {
+            SimplexClient client(path);
+            std::vector<std::vector<double>> expected(problems.size());
+            std::vector<System::SolutionType> expected_types(problems.size());
+            for (size_t k = 0; k < problems.size(); ++k) {
+                expected_types[k] = TestUtils::solve_reference(problems[k], expected[k]);
+                client.solve(make_request(problems[k], k), response);
+                CHECK(response.id == k && response.status == static_cast<uint8_t>(expected_types[k]));
+                if (expected_types[k] == System::SolutionType::BOUNDED) {
+                    CHECK(TestUtils::near(response.solution, expected[k]));
+                } else {
+                    CHECK(response.solution.empty());
+                }
+            }
+            for (size_t k = 0; k < problems.size(); ++k) {
+                client.send(make_request(problems[k], 100 + k));
+            }
+            std::vector<bool> answered(problems.size(), false);
+            for (size_t k = 0; k < problems.size(); ++k) {
+                client.receive(response);
+                size_t position = response.id - 100;
+                CHECK(position < problems.size() && !answered[position]);
+                if (position < problems.size()) {
+                    answered[position] = true;
+                    CHECK(response.status == static_cast<uint8_t>(expected_types[position]));
+                }
+            }
+
+            // a model sent again starts from the optimal base of its first solve, kept in the global cache
+            BasisCache<double>::global()->clear();
+            client.solve(make_request(problems[0], 150), response);
+            CHECK(response.status == static_cast<uint8_t>(System::SolutionType::BOUNDED));
+            CHECK(BasisCache<double>::global()->size() == 1 && BasisCache<double>::global()->hits() == 0);
+            client.solve(make_request(problems[0], 151), response);
+            CHECK(response.status == static_cast<uint8_t>(System::SolutionType::BOUNDED));
+            CHECK(TestUtils::near(response.solution, expected[0]));
+            CHECK(BasisCache<double>::global()->hits() == 1);
+
+            // requests that can not be solved are answered with their error
+            SimplexProtocol::Request empty;
+            empty.id = 200;
+            client.solve(empty, response);
+            CHECK(response.id == 200 && response.status == SimplexProtocol::ERROR);
+            CHECK(response.error == "The constrain system is empty");
+        }
+        {
+            // a malformed request gets an error, and the connection stays usable
+            int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+            CHECK(::connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+            SimplexProtocol::encode(make_request(problems[0], 300), message);
+            message[21] = 3;
+            SimplexProtocol::write_frame(socket, message);
+            CHECK(SimplexProtocol::read_frame(socket, received));
+            SimplexProtocol::decode(received, response);
+            CHECK(response.id == 300 && response.status == SimplexProtocol::ERROR);
+            CHECK(response.error == "Unknown constrain type");
+            SimplexProtocol::encode(make_request(problems[0], 301), message);
+            SimplexProtocol::write_frame(socket, message);
+            CHECK(SimplexProtocol::read_frame(socket, received));
+            SimplexProtocol::decode(received, response);
+            CHECK(response.id == 301 && response.status == static_cast<uint8_t>(System::SolutionType::BOUNDED));
+            ::close(socket);
+        }
+        server.stop();
+        acceptor.join();
+    }
+    std::cout.clear();
+    #endif // SIMPLEX_HAS_UNIX_SOCKETS
+
+    return TestUtils::report();
+}
@@ -0,0 +1,213 @@
+// BigInteger and Rational: arithmetic compared with long long, signs, carries and borrows across
+// limbs, the add-back step of the division, and fractions in lowest terms
+
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/Rational.hpp"
+#include "TestUtils.hpp"
+
+
+/**
+ * @brief method to get 2^exponent
+ */
+BigInteger power_of_2(size_t exponent) {
+    BigInteger result(1);
+    result <<= exponent;
+    return result;
+}
+
+
+/**
+ * @brief method to check quotient and remainder of a division against the definition: a = q*b + r,
+ * with |r| < |b| and r of the sign of a
+ */
+bool divides(const BigInteger& a, const BigInteger& b, const BigInteger& quotient, const BigInteger& remainder) {
+    BigInteger magnitude = b.sign() < 0 ? -b : b;
+    BigInteger remainder_magnitude = remainder.sign() < 0 ? -remainder : remainder;
+    return quotient * b + remainder == a && remainder_magnitude < magnitude &&
+           (remainder.is_zero() || remainder.sign() == a.sign());
+}
+
+
+/**
+ * @brief method to get a random number of up to limbs 32-bit limbs, with a random sign
+ */
+BigInteger random_integer(std::minstd_rand& engine, size_t limbs) {
+    std::uniform_int_distribution<long long> limb(0, 0xffffffffll);
+    BigInteger result;
+    for (size_t k = 0; k < limbs; ++k) {
+        result <<= 32;
+        // limbs of all zeros or all ones, where carries and borrows run the longest
+        long long value = limb(engine);
+        result += BigInteger(value % 4 == 0 ? 0 : (value % 4 == 1 ? 0xffffffffll : value));
+    }
+    return limb(engine) % 2 == 0 ? result : -result;
+}
+
+
+int main() {
+
+    // small values compared with long long, every combination of signs; products fit in long long
+    std::vector<long long> values = {0, 1, -1, 2, -7, 7, 12, -18, 65535, -65536, 2147483647, -2147483648ll, 3037000499ll};
+    for (long long a : values) {
+        CHECK(BigInteger(a).to_string() == std::to_string(a));
+        CHECK(BigInteger(a).sign() == (a > 0) - (a < 0));
+        CHECK((-BigInteger(a)).to_string() == std::to_string(-a));
+        for (long long b : values) {
+            CHECK((BigInteger(a) + BigInteger(b)).to_string() == std::to_string(a + b));
+            CHECK((BigInteger(a) - BigInteger(b)).to_string() == std::to_string(a - b));
+            CHECK((BigInteger(a) * BigInteger(b)).to_string() == std::to_string(a * b));
+            CHECK(BigInteger::compare(BigInteger(a), BigInteger(b)) == (a > b) - (a < b));
+            if (b != 0) {
+                BigInteger quotient, remainder;
+                BigInteger::divide(BigInteger(a), BigInteger(b), quotient, remainder);
+                // rounding towards 0, as the integer division of C++
+                CHECK(quotient.to_string() == std::to_string(a / b));
+                CHECK(remainder.to_string() == std::to_string(a % b));
+            }
+        }
+    }
+    CHECK(BigInteger(LLONG_MIN).to_string() == std::to_string(LLONG_MIN));
+    CHECK(BigInteger(LLONG_MAX).to_string() == std::to_string(LLONG_MAX));
+    // 0 is never negative
+    CHECK((BigInteger(5) - BigInteger(5)).sign() == 0 && (-BigInteger()).sign() == 0);
+    CHECK((BigInteger(-5) * BigInteger()).to_string() == "0");
+
+    // carries and borrows across limbs
+    BigInteger all_ones = power_of_2(96) - BigInteger(1);
+    CHECK(all_ones.to_string() == "79228162514264337593543950335");
+    CHECK(all_ones + BigInteger(1) == power_of_2(96));
+    CHECK(power_of_2(96) - all_ones == BigInteger(1));
+    CHECK(BigInteger(1) - power_of_2(96) == -all_ones);
+    CHECK((BigInteger(4294967295ll) + BigInteger(1)).to_string() == "4294967296");
+    CHECK((power_of_2(64) - BigInteger(1)).to_string() == "18446744073709551615");
+    // (2^64 - 1)^2 = 2^128 - 2^65 + 1
+    BigInteger square = (power_of_2(64) - BigInteger(1)) * (power_of_2(64) - BigInteger(1));
+    CHECK(square == power_of_2(128) - power_of_2(65) + BigInteger(1));
+    CHECK(square.to_string() == "340282366920938463426481119284349108225");
+    CHECK(square.bit_length() == 128 && power_of_2(128).bit_length() == 129);
+    BigInteger shifted = all_ones;
+    shifted >>= 40;
+    CHECK(shifted == power_of_2(56) - BigInteger(1));
+    shifted <<= 40;
+    CHECK(shifted == all_ones - (power_of_2(40) - BigInteger(1)));
+
+    // divisions whose first estimate of a quotient limb is one too large, so the divisor is added back
+    BigInteger quotient, remainder;
+    BigInteger::divide(power_of_2(95) + BigInteger(3), power_of_2(93) + BigInteger(1), quotient, remainder);
+    CHECK(quotient == BigInteger(3) && remainder == power_of_2(93));
+    BigInteger::divide(power_of_2(79) + BigInteger(3), power_of_2(77) + BigInteger(1), quotient, remainder);
+    CHECK(quotient == BigInteger(3) && remainder == power_of_2(77));
+    // 2^111 = (2^32 - 1)(2^79 + 1) + 2^79 - 2^32 + 1
+    BigInteger::divide(power_of_2(111), power_of_2(79) + BigInteger(1), quotient, remainder);
+    CHECK(quotient == BigInteger(4294967295ll) && remainder == power_of_2(79) - power_of_2(32) + BigInteger(1));
+    BigInteger::divide(-power_of_2(111), power_of_2(79) + BigInteger(1), quotient, remainder);
+    CHECK(quotient == BigInteger(-4294967295ll) && remainder == -(power_of_2(79) - power_of_2(32) + BigInteger(1)));
+    BigInteger dividend = power_of_2(111) + BigInteger(0xfffe) * power_of_2(32);
+    BigInteger divisor = power_of_2(79) + BigInteger(0xffff);
+    BigInteger::divide(dividend, divisor, quotient, remainder);
+    CHECK(divides(dividend, divisor, quotient, remainder) && quotient == BigInteger(4294967295ll));
+    // a divisor longer than the dividend, and a single limb divisor
+    BigInteger::divide(BigInteger(-5), power_of_2(70), quotient, remainder);
+    CHECK(quotient.is_zero() && remainder == BigInteger(-5));
+    BigInteger::divide(all_ones, BigInteger(-3), quotient, remainder);
+    CHECK(divides(all_ones, BigInteger(-3), quotient, remainder) && remainder.is_zero());
+    bool thrown = false;
+    try {
+        BigInteger::divide(all_ones, BigInteger(), quotient, remainder);
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    // random numbers of several limbs, checked by identities
+    std::minstd_rand engine(3);
+    for (size_t round = 0; round < 2000; ++round) {
+        BigInteger a = random_integer(engine, 1 + round % 7);
+        BigInteger b = random_integer(engine, 1 + (round / 7) % 5);
+        CHECK(a + b - b == a && a - b + b == a);
+        CHECK(a + b == b + a && a * b == b * a);
+        if (!b.is_zero()) {
+            BigInteger::divide(a, b, quotient, remainder);
+            CHECK(divides(a, b, quotient, remainder));
+            CHECK(a * b / b == a);
+        }
+    }
+
+    // greatest common divisors are positive
+    CHECK(BigInteger::gcd(BigInteger(-12), BigInteger(18)) == BigInteger(6));
+    CHECK(BigInteger::gcd(BigInteger(12), BigInteger(-18)) == BigInteger(6));
+    CHECK(BigInteger::gcd(BigInteger(), BigInteger(-5)) == BigInteger(5));
+    CHECK(BigInteger::gcd(BigInteger(), BigInteger()).is_zero());
+    CHECK(BigInteger::gcd(power_of_2(100) * BigInteger(3), power_of_2(70) * BigInteger(9)) == power_of_2(70) * BigInteger(3));
+
+    // fractions in lowest terms with positive denominator
+    Rational half(BigInteger(6), BigInteger(-12));
+    CHECK(half.to_string() == "-1/2" && half.denominator() == BigInteger(2) && half.sign() < 0);
+    CHECK(Rational(BigInteger(-6), BigInteger(-4)).to_string() == "3/2");
+    CHECK(Rational(BigInteger(), BigInteger(-5)).to_string() == "0" && Rational(BigInteger(), BigInteger(-5)).denominator() == BigInteger(1));
+    CHECK(Rational(BigInteger(4), BigInteger(2)).to_string() == "2");
+    CHECK(Rational(power_of_2(80), power_of_2(90) * BigInteger(3)) == Rational(BigInteger(1), power_of_2(10) * BigInteger(3)));
+    thrown = false;
+    try {
+        Rational(BigInteger(1), BigInteger());
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    // arithmetic of fractions, every result in lowest terms
+    Rational third(BigInteger(1), BigInteger(3));
+    Rational sixth(BigInteger(1), BigInteger(6));
+    CHECK((third + sixth).to_string() == "1/2");
+    CHECK((sixth - third).to_string() == "-1/6");
+    CHECK((third - third).to_string() == "0" && (third - third).denominator() == BigInteger(1));
+    // equal denominators whose sum shares a factor with them
+    CHECK((sixth + Rational(BigInteger(5), BigInteger(6))).to_string() == "1");
+    CHECK((Rational(BigInteger(2), BigInteger(3)) * Rational(BigInteger(9), BigInteger(4))).to_string() == "3/2");
+    CHECK((Rational(BigInteger(2), BigInteger(3)) * Rational(BigInteger(-9), BigInteger(4))).to_string() == "-3/2");
+    CHECK((Rational(BigInteger(2), BigInteger(3)) / Rational(BigInteger(-4), BigInteger(9))).to_string() == "-3/2");
+    CHECK((Rational(BigInteger(-2), BigInteger(3)) / Rational(BigInteger(-4), BigInteger(9))).to_string() == "3/2");
+    CHECK((third * Rational()).to_string() == "0");
+    thrown = false;
+    try {
+        third /= Rational();
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    CHECK(third < Rational(BigInteger(1), BigInteger(2)) && -third > Rational(BigInteger(-1), BigInteger(2)));
+    CHECK(third <= third && third >= third && !(third < third) && third != sixth);
+
+    // doubles convert exactly and back
+    CHECK(Rational(0.1).to_string() == "3602879701896397/36028797018963968");
+    CHECK(Rational(-0.75).to_string() == "-3/4" && Rational(0.0).to_string() == "0");
+    CHECK(Rational(1e300).denominator() == BigInteger(1));
+    CHECK(Rational(0.1) + Rational(0.2) != Rational(0.3));
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    std::uniform_int_distribution<int> exponent(-300, 300);
+    for (size_t round = 0; round < 1000; ++round) {
+        double value = std::ldexp(uniform(engine), exponent(engine));
+        CHECK(Rational(value).to_double() == value);
+        Rational sum = Rational(value) + Rational(-value);
+        CHECK(sum.is_zero() && sum.denominator() == BigInteger(1));
+        if (value != 0) {
+            CHECK((Rational(value) / Rational(value)).to_string() == "1");
+        }
+    }
+    thrown = false;
+    try {
+        Rational(std::numeric_limits<double>::infinity());
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return TestUtils::report();
+}
@@ -0,0 +1,176 @@
+// Tableaus rebuilt from their base after every pivot compared with the default checks of the basic
+// solution, and long optimizations of badly scaled problems kept feasible by reinversion
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+/**
+ * @brief method to get a random problem with LE, GE and EQ rows, feasible at a random point, whose
+ * rows and columns are scaled by factors from 1e-3 to 1e3 so that rounding errors of the pivots grow
+ * quickly; minimizing positive costs keeps it bounded
+ */
+TestUtils::Problem badly_scaled(size_t rows, size_t columns, unsigned seed) {
+    std::minstd_rand engine(seed);
+    std::uniform_real_distribution<double> value(-5, 10);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::uniform_real_distribution<double> exponent(-3, 3);
+    std::vector<double> point(columns);
+    std::vector<double> column_scale(columns);
+    for (size_t j = 0; j < columns; ++j) {
+        point[j] = uniform(engine) < 0.5 ? 0 : 5 * uniform(engine);
+        column_scale[j] = std::pow(10.0, exponent(engine));
+    }
+    TestUtils::Problem problem;
+    problem.name = "badly_scaled_" + std::to_string(seed);
+    problem.constrains.resize(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        auto& constrain = problem.constrains[i];
+        constrain.a.assign(columns, 0);
+        double row_scale = std::pow(10.0, exponent(engine));
+        double activity = 0;
+        for (size_t j = 0; j < columns; ++j) {
+            if (uniform(engine) < 0.5 || j % rows == i) {
+                constrain.a[j] = value(engine) * row_scale * column_scale[j];
+                activity += constrain.a[j] * point[j];
+            }
+        }
+        double kind = uniform(engine);
+        if (kind < 0.3) {
+            constrain.type = System::ConstrainType::EQ;
+            constrain.b = activity;
+        } else if (kind < 0.65) {
+            constrain.type = System::ConstrainType::LE;
+            constrain.b = activity + 3 * row_scale * uniform(engine);
+        } else {
+            constrain.type = System::ConstrainType::GE;
+            constrain.b = activity - 3 * row_scale * uniform(engine);
+        }
+    }
+    problem.c.resize(columns);
+    for (auto& coefficient : problem.c) {
+        coefficient = 1 + 9 * uniform(engine);
+    }
+    problem.type = System::OptimizationType::MIN;
+    problem.expected = System::SolutionType::BOUNDED;
+    problem.z = 0;
+    return problem;
+}
+
+
+/**
+ * @brief method to get the largest violation of a constrain by a solution, relative to 1 + |b|
+ */
+double violation(const TestUtils::Problem& problem, const std::vector<double>& solution) {
+    double largest = 0;
+    for (const auto& constrain : problem.constrains) {
+        double value = 0;
+        for (size_t j = 0; j < constrain.a.size(); ++j) {
+            value += constrain.a[j] * solution[j];
+        }
+        double excess = 0;
+        if (constrain.type != System::ConstrainType::GE && value > constrain.b) {
+            excess = value - constrain.b;
+        } else if (constrain.type != System::ConstrainType::LE && value < constrain.b) {
+            excess = constrain.b - value;
+        }
+        largest = std::max(largest, excess / (1 + std::fabs(constrain.b)));
+    }
+    for (size_t j = 0; j + 1 < solution.size(); ++j) {
+        largest = std::max(largest, -solution[j]);
+    }
+    return largest;
+}
+
+
+/**
+ * @brief method to check that the duals of an optimized system prove its solution optimal: they are
+ * feasible for the dual problem and their objective value b*y equals z
+ */
+bool optimal(const TestUtils::Problem& problem, System& system, const std::vector<double>& solution, double tolerance = 1e-9) {
+    std::vector<double> duals;
+    system.get_duals(duals);
+    // y = dz/db, of the sign of the improvement of z given by a larger b
+    double sign = (problem.type == System::OptimizationType::MIN) ? 1 : -1;
+    double dual_z = 0;
+    for (size_t i = 0; i < duals.size(); ++i) {
+        const auto& constrain = problem.constrains[i];
+        if ((constrain.type == System::ConstrainType::LE && sign * duals[i] > tolerance) ||
+            (constrain.type == System::ConstrainType::GE && sign * duals[i] < -tolerance)) {
+            return false;
+        }
+        dual_z += duals[i] * constrain.b;
+    }
+    for (size_t j = 0; j < problem.c.size(); ++j) {
+        double reduced_cost = problem.c[j];
+        for (size_t i = 0; i < duals.size(); ++i) {
+            reduced_cost -= duals[i] * problem.constrains[i].a[j];
+        }
+        if (sign * reduced_cost < -tolerance * (1 + std::fabs(problem.c[j]))) {
+            return false;
+        }
+    }
+    return TestUtils::near(dual_z, solution.back(), tolerance);
+}
+
+
+int main() {
+
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(30, 40, 0.3, seed));
+    }
+
+    // a negative threshold rebuilds the tableau after every pivot, whatever its residual: the results
+    // are the ones of the default checks
+    for (const auto& problem : problems) {
+        std::cout << "Problem " << problem.name << std::endl;
+        std::vector<double> expected;
+        std::vector<double> solution;
+        System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+        System system;
+        system.set_reinversion(1, -1);
+        TestUtils::load(system, problem);
+        CHECK(TestUtils::solve(system, problem, solution) == reference);
+        CHECK(reference == problem.expected);
+        if (reference == System::SolutionType::BOUNDED) {
+            CHECK(TestUtils::near(solution, expected, 1e-9));
+            CHECK(TestUtils::satisfies(problem, solution));
+            CHECK(optimal(problem, system, solution));
+            if (problem.z != 0) {
+                CHECK(TestUtils::near(solution.back(), problem.z));
+            }
+        }
+    }
+
+    // hundreds of pivots on badly scaled rows: without reinversion rounding errors can make a base look
+    // optimal before the optimum (badly_scaled_17 on x86-64), rebuilt after every pivot the tableau
+    // stays feasible and ends at a base whose duals prove it optimal
+    for (unsigned seed : {1u, 2u, 3u, 4u, 17u}) {
+        TestUtils::Problem problem = badly_scaled(60, 80, seed);
+        std::vector<double> unchecked;
+        std::vector<double> solution;
+        System without;
+        without.set_reinversion(0, 0);
+        TestUtils::load(without, problem);
+        CHECK(TestUtils::solve(without, problem, unchecked) == System::SolutionType::BOUNDED);
+        System system;
+        system.set_reinversion(1, -1);
+        TestUtils::load(system, problem);
+        CHECK(TestUtils::solve(system, problem, solution) == System::SolutionType::BOUNDED);
+        std::cout << "Problem " << problem.name << ", z without reinversion " << unchecked.back() << (optimal(problem, without, unchecked) ? "" : " (not optimal)")
+                  << ", with reinversion after every pivot " << solution.back() << std::endl;
+        CHECK(violation(problem, solution) < 1e-10);
+        CHECK(optimal(problem, system, solution));
+        CHECK(solution.back() <= unchecked.back() + 1e-9 * (1 + std::fabs(unchecked.back())));
+    }
+
+    return TestUtils::report();
+}
@@ -0,0 +1,102 @@
+// Tableaus kept in a memory-mapped scratch file compared with tableaus on the heap, and reuse of the
+// blocks released to MappedArena
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+
+
+int main() {
+
+    #ifdef SIMPLEX_HAS_MMAP
+    // a scratch file of its own for every test process
+    const std::string path = "/tmp/simplex_scratch_" + std::to_string(::getpid());
+
+    // rows grown 64 bytes at a time, as by repeated calls of add_variable, reuse the blocks they
+    // release: the file stays within a few times the live rows, each row keeps its own values
+    MappedArena arena(path, 4096);
+    const size_t rows = 40;
+    std::vector<unsigned char*> blocks(rows);
+    size_t bytes = 64;
+    for (size_t i = 0; i < rows; ++i) {
+        blocks[i] = static_cast<unsigned char*>(arena.allocate(bytes));
+        std::memset(blocks[i], static_cast<int>(i), bytes);
+    }
+    for (size_t round = 0; round < 60; ++round) {
+        for (size_t i = 0; i < rows; ++i) {
+            unsigned char* grown = static_cast<unsigned char*>(arena.allocate(bytes + 64));
+            std::memcpy(grown, blocks[i], bytes);
+            std::memset(grown + bytes, static_cast<int>(i), 64);
+            arena.deallocate(blocks[i], bytes);
+            blocks[i] = grown;
+        }
+        bytes += 64;
+    }
+    bool intact = true;
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t k = 0; k < bytes; ++k) {
+            intact = intact && blocks[i][k] == static_cast<unsigned char>(i);
+        }
+    }
+    CHECK(intact);
+    std::cout << "Live bytes: " << rows * bytes << ", scratch file: " << arena.size() << std::endl;
+    CHECK(arena.size() <= 3 * rows * bytes + 4096);
+    // blocks released at the end of the last chunk are handed out again
+    for (size_t i = 0; i < rows; ++i) {
+        arena.deallocate(blocks[i], bytes);
+    }
+    size_t file_size = arena.size();
+    for (size_t i = 0; i < rows; ++i) {
+        blocks[i] = static_cast<unsigned char*>(arena.allocate(bytes));
+    }
+    CHECK(arena.size() == file_size);
+
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(30, 40, 0.3, seed));
+    }
+
+    // the same pivots on rows in the file and on rows on the heap
+    for (const auto& problem : problems) {
+        std::cout << "Problem " << problem.name << std::endl;
+        std::vector<double> expected;
+        std::vector<double> solution;
+        System heap;
+        TestUtils::load(heap, problem);
+        System::SolutionType reference = TestUtils::solve(heap, problem, expected);
+        System mapped;
+        mapped.set_scratch_file(path, 4096);
+        TestUtils::load(mapped, problem);
+        CHECK(TestUtils::solve(mapped, problem, solution) == reference);
+        CHECK(reference == problem.expected);
+        if (reference != System::SolutionType::BOUNDED) {
+            continue;
+        }
+        CHECK(mapped.get_iterations() == heap.get_iterations());
+        CHECK(TestUtils::near(solution, expected, 1e-12));
+        CHECK(TestUtils::satisfies(problem, solution));
+
+        // columns added to the solved systems reallocate every row of the tableau in the file
+        for (size_t round = 0; round < 5; ++round) {
+            std::vector<double> column(problem.constrains.size());
+            for (size_t i = 0; i < column.size(); ++i) {
+                column[i] = static_cast<double>((i + round) % 3);
+            }
+            double cost = (problem.type == System::OptimizationType::MAX) ? 1.0 + round : -1.0 - round;
+            System::SolutionType heap_type = heap.add_variable(expected, column, cost);
+            CHECK(mapped.add_variable(solution, column, cost) == heap_type);
+            if (heap_type != System::SolutionType::BOUNDED) {
+                break;
+            }
+            CHECK(TestUtils::near(solution, expected, 1e-12));
+        }
+    }
+    #endif // SIMPLEX_HAS_MMAP
+
+    return TestUtils::report();
+}
@@ -0,0 +1,178 @@
+// Sensitivity information of optimize checked against its definitions: duals with b*y = z, reduced
+// costs c - y*A, slacks b - a*x and base status, after the simplex, the exact verification and the
+// network simplex
+
+#include <cmath>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+typedef TestUtils::System System;
+typedef System::VariableStatus Status;
+
+
+/**
+ * @brief method to generate a transportation problem with the given supplies and demands: a LE row
+ * for every source and a GE row for every destination, minimizing the cost of shipments
+ */
+TestUtils::Problem transportation(const std::vector<double>& supplies, const std::vector<double>& demands,
+                                  const std::vector<double>& costs) {
+
+    size_t sources = supplies.size();
+    size_t destinations = demands.size();
+    TestUtils::Problem problem;
+    problem.name = "transportation";
+    problem.constrains.resize(sources + destinations);
+    for (size_t i = 0; i < sources + destinations; ++i) {
+        problem.constrains[i].a.assign(sources * destinations, 0);
+    }
+    for (size_t i = 0; i < sources; ++i) {
+        for (size_t j = 0; j < destinations; ++j) {
+            problem.constrains[i].a[i * destinations + j] = 1;
+            problem.constrains[sources + j].a[i * destinations + j] = 1;
+        }
+        problem.constrains[i].b = supplies[i];
+        problem.constrains[i].type = System::ConstrainType::LE;
+    }
+    for (size_t j = 0; j < destinations; ++j) {
+        problem.constrains[sources + j].b = demands[j];
+        problem.constrains[sources + j].type = System::ConstrainType::GE;
+    }
+    problem.c = costs;
+    problem.type = System::OptimizationType::MIN;
+    problem.expected = System::SolutionType::BOUNDED;
+    problem.z = 0;
+    return problem;
+}
+
+
+/**
+ * @brief method to check the sensitivity information of a bounded problem against its definitions
+ */
+void check_sensitivity(const TestUtils::Problem& problem, const std::vector<double>& solution, const System::SensitivityInfo& info) {
+
+    size_t rows = problem.constrains.size();
+    size_t columns = problem.c.size();
+    CHECK(info.duals.size() == rows && info.slacks.size() == rows && info.row_status.size() == rows);
+    CHECK(info.reduced_costs.size() == columns && info.column_status.size() == columns);
+    if (info.duals.size() != rows || info.reduced_costs.size() != columns) {
+        return;
+    }
+    // y = dz/db, of the sign of the improvement of z given by a larger b
+    double sign = (problem.type == System::OptimizationType::MIN) ? 1 : -1;
+
+    // variables in base, decisional or logical; artificial variables left at 0 in the base are not
+    // counted, and are priced by their M cost only: the duals then solve y*B = c_B with signs that
+    // need not be the ones of the dual problem
+    size_t basic = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        basic += info.row_status[i] == Status::BASIC;
+    }
+    for (size_t j = 0; j < columns; ++j) {
+        basic += info.column_status[j] == Status::BASIC;
+    }
+    CHECK(basic <= rows);
+    bool dual_feasible = basic == rows;
+
+    // strong duality
+    double dual_z = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        dual_z += info.duals[i] * problem.constrains[i].b;
+    }
+    CHECK(TestUtils::near(dual_z, solution.back()));
+
+    for (size_t i = 0; i < rows; ++i) {
+        const auto& constrain = problem.constrains[i];
+        double activity = 0;
+        for (size_t j = 0; j < columns; ++j) {
+            activity += constrain.a[j] * solution[j];
+        }
+        double scale = 1 + std::fabs(constrain.b);
+        if (constrain.type == System::ConstrainType::EQ) {
+            CHECK(info.slacks[i] == 0);
+        } else {
+            CHECK(std::fabs(info.slacks[i] - (constrain.b - activity)) <= 1e-9 * scale);
+        }
+        // dual feasibility, and complementary slackness: a basic logical variable has dual value 0,
+        // a row whose logical variable is nonbasic is active
+        if (dual_feasible && constrain.type == System::ConstrainType::LE) {
+            CHECK(sign * info.duals[i] <= 1e-9);
+        } else if (dual_feasible && constrain.type == System::ConstrainType::GE) {
+            CHECK(sign * info.duals[i] >= -1e-9);
+        }
+        if (info.row_status[i] == Status::BASIC) {
+            CHECK(std::fabs(info.duals[i]) <= 1e-9);
+        } else {
+            CHECK(std::fabs(info.slacks[i]) <= 1e-9 * scale);
+        }
+    }
+
+    for (size_t j = 0; j < columns; ++j) {
+        double reduced_cost = problem.c[j];
+        for (size_t i = 0; i < rows; ++i) {
+            reduced_cost -= info.duals[i] * problem.constrains[i].a[j];
+        }
+        double scale = 1 + std::fabs(problem.c[j]);
+        CHECK(std::fabs(info.reduced_costs[j] - reduced_cost) <= 1e-9 * scale);
+        CHECK(!dual_feasible || sign * info.reduced_costs[j] >= -1e-9 * scale);
+        if (info.column_status[j] == Status::BASIC) {
+            CHECK(std::fabs(info.reduced_costs[j]) <= 1e-9 * scale);
+        } else {
+            CHECK(solution[j] == 0);
+        }
+    }
+}
+
+
+int main() {
+
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(15, 20, 0.3, seed));
+    }
+    problems.push_back(transportation({30, 40, 25}, {20, 35, 25, 10}, {8, 6, 10, 9, 9, 12, 13, 7, 14, 9, 16, 5}));
+    problems.push_back(transportation({10, 10}, {10, 10}, {1, 2, 2, 1}));
+
+    // optimize with sensitivity information dispatches as optimize does
+    for (int mode = 0; mode < 3; ++mode) {
+        for (const auto& problem : problems) {
+            std::cout << "Problem " << problem.name << ", " << (mode == 0 ? "simplex" : (mode == 1 ? "exact verification" : "network detection")) << std::endl;
+            std::vector<double> expected;
+            std::vector<double> solution;
+            System reference;
+            reference.set_exact_verification(mode == 1).set_network_detection(mode == 2);
+            TestUtils::load(reference, problem);
+            System::SolutionType reference_type = TestUtils::solve(reference, problem, expected);
+            System system;
+            system.set_exact_verification(mode == 1).set_network_detection(mode == 2);
+            TestUtils::load(system, problem);
+            System::SensitivityInfo info;
+            System::SolutionType sol_type;
+            try {
+                sol_type = system.optimize(solution, problem.c, problem.type, info);
+            } catch (const InfeasibleSystemError&) {
+                sol_type = System::SolutionType::INFEASIBLE;
+            }
+            CHECK(sol_type == reference_type);
+            CHECK(sol_type == problem.expected);
+            if (sol_type != System::SolutionType::BOUNDED) {
+                continue;
+            }
+            // the same path as optimize, to the same pivots
+            CHECK(system.get_iterations() == reference.get_iterations());
+            CHECK(solution == expected);
+            CHECK(TestUtils::satisfies(problem, solution));
+            if (mode == 1) {
+                CHECK(system.get_exact_pivots() == reference.get_exact_pivots());
+            }
+            check_sensitivity(problem, solution, info);
+            // the same dual values as post-optimal analysis
+            std::vector<double> duals;
+            system.get_duals(duals);
+            CHECK(TestUtils::near(duals, info.duals));
+        }
+    }
+
+    return TestUtils::report();
+}
@@ -0,0 +1,51 @@
+// Solutions of the sparse pivot update compared with the dense one and with the expected results
+
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+int main() {
+
+    typedef TestUtils::System System;
+    std::vector<TestUtils::Problem> problems = TestUtils::example_problems();
+    // slack-heavy problems whose pivot rows are mostly zero
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        problems.push_back(TestUtils::random_problem(30, 40, 0.1, seed));
+    }
+
+    for (const auto& problem : problems) {
+        std::cout << "Problem " << problem.name << std::endl;
+        std::vector<double> expected;
+        std::vector<double> dense_solution;
+        std::vector<double> sparse_solution;
+        System::SolutionType reference = TestUtils::solve_reference(problem, expected);
+
+        // threshold 0: whole rows are always updated
+        System dense;
+        TestUtils::load(dense, problem);
+        dense.set_sparse_pivot_threshold(0);
+        System::SolutionType dense_type = TestUtils::solve(dense, problem, dense_solution);
+        // threshold 1: only nonzero elements of pivot row and pivot column are always updated
+        System sparse;
+        TestUtils::load(sparse, problem);
+        sparse.set_sparse_pivot_threshold(1);
+        System::SolutionType sparse_type = TestUtils::solve(sparse, problem, sparse_solution);
+
+        CHECK(reference == problem.expected);
+        CHECK(dense_type == problem.expected);
+        CHECK(sparse_type == problem.expected);
+        if (sparse_type == System::SolutionType::BOUNDED) {
+            // skipped elements are multiplied by 0: both updates follow the same pivots
+            CHECK(sparse.get_iterations() == dense.get_iterations());
+            CHECK(TestUtils::near(sparse_solution, dense_solution, 1e-12));
+            CHECK(TestUtils::near(sparse_solution, expected));
+            CHECK(TestUtils::satisfies(problem, sparse_solution));
+            if (problem.z != 0) {
+                CHECK(TestUtils::near(sparse_solution.back(), problem.z));
+            }
+        }
+    }
+
+    return TestUtils::report();
+}
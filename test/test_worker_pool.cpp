@@ -0,0 +1,39 @@
+// Tasks run by WorkerPool: every part runs once per task, and threads are reused across tasks
+
+#include <atomic>
+#include <vector>
+
+#include "../include/WorkerPool.hpp"
+#include "TestUtils.hpp"
+
+
+int main() {
+
+    for (size_t num_threads : {1, 2, 4, 7}) {
+        WorkerPool pool(num_threads);
+        CHECK(pool.size() == num_threads);
+        std::vector<size_t> runs(num_threads, 0);
+        std::atomic<size_t> total{0};
+        const size_t tasks = 2000;
+        for (size_t task = 0; task < tasks; ++task) {
+            // every part writes its own element: no synchronization is needed inside the task
+            pool.run([&runs, &total, task](size_t part) {
+                runs[part]++;
+                total += task;
+            });
+        }
+        bool every_part = true;
+        for (size_t part = 0; part < num_threads; ++part) {
+            every_part = every_part && runs[part] == tasks;
+        }
+        CHECK(every_part);
+        CHECK(total == num_threads * tasks * (tasks - 1) / 2);
+    }
+
+    // a pool destroyed without tasks stops its threads
+    {
+        WorkerPool idle(3);
+    }
+
+    return TestUtils::report();
+}
@@ -0,0 +1,89 @@
+// Steady-state optimizations of a reused LinearConstrainSystem must not allocate memory
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+
+static size_t allocations = 0;    //!< number of calls to operator new so far
+
+void* operator new(size_t size) {
+    allocations++;
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+
+int main() {
+
+    typedef TestUtils::System System;
+    const size_t rows = 12;
+    const size_t columns = 9;
+    const size_t warm_up = 3;
+    const size_t repetitions = 50;
+
+    // every repetition loads a different problem of the same shape, with rows of every type
+    std::vector<std::vector<double>> a(rows, std::vector<double>(columns));
+    std::vector<double> b(rows);
+    std::vector<System::ConstrainType> types(rows);
+    std::vector<double> c(columns);
+    std::vector<double> solution;
+    solution.reserve(columns + 1);
+    auto load = [&](size_t repetition) {
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < columns; ++j) {
+                a[i][j] = 1 + static_cast<double>((7 * i + 3 * j + repetition) % 11);
+            }
+            types[i] = (i % 4 == 0) ? System::ConstrainType::GE : System::ConstrainType::LE;
+            b[i] = (types[i] == System::ConstrainType::GE) ? 5 + static_cast<double>(repetition % 3) : 100 + static_cast<double>((i + repetition) % 7);
+        }
+        for (size_t j = 0; j < columns; ++j) {
+            c[j] = 1 + static_cast<double>((j + repetition) % 5);
+        }
+    };
+
+    System system;
+    load(0);
+    for (size_t i = 0; i < rows; ++i) {
+        system.add_constrain(a[i], b[i], types[i]);
+    }
+
+    size_t warm_up_allocations = 0;
+    size_t steady_allocations = 0;
+    size_t bounded = 0;
+    for (size_t repetition = 0; repetition < warm_up + repetitions; ++repetition) {
+        load(repetition);
+        size_t before = allocations;
+        for (size_t i = 0; i < rows; ++i) {
+            system.set_constrain(i, a[i], b[i], types[i]);
+        }
+        System::SolutionType sol_type = system.optimize(solution, c, System::OptimizationType::MAX);
+        if (repetition >= warm_up) {
+            steady_allocations += allocations - before;
+        } else {
+            warm_up_allocations += allocations - before;
+        }
+        bounded += (sol_type == System::SolutionType::BOUNDED);
+    }
+
+    std::cout << "Allocations after warm-up: " << steady_allocations << std::endl;
+    // the first optimization builds the tableau: the counter is in use
+    CHECK(warm_up_allocations > 0);
+    CHECK(bounded == warm_up + repetitions);
+    CHECK(steady_allocations == 0);
+
+    return TestUtils::report();
+}